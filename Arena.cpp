@@ -0,0 +1,148 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "Arena.h"
+#include "Mem.h"
+#include <algorithm>
+#include <cstring>
+
+Arena::Arena(size_t chunkSize)
+    : _chunk(0), _offset(0), _usedBefore(0), _chunkSize(chunkSize), _last(nullptr), _destructors(nullptr)
+{
+}
+
+Arena::~Arena()
+{
+    Reset();
+
+    for(auto& chunk : _chunks)
+        AlignedFree(chunk.data);
+}
+
+void* Arena::Allocate(size_t size, size_t alignment)
+{
+    if(_chunk < _chunks.size())
+    {
+        Chunk& chunk = _chunks[_chunk];
+        uintptr_t base = (uintptr_t)chunk.data;
+        size_t offset = ((base + _offset + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+
+        if(offset + size <= chunk.size)
+        {
+            _offset = offset + size;
+            _last = chunk.data + offset;
+            return _last;
+        }
+    }
+
+    return AllocateFromNextChunk(size, alignment);
+}
+
+void* Arena::AllocateFromNextChunk(size_t size, size_t alignment)
+{
+    // the rest of the current chunk goes unused until the next reset
+    size_t next = 0;
+    if(_chunk < _chunks.size())
+    {
+        _usedBefore += _offset;
+        next = _chunk + 1;
+    }
+
+    while(next < _chunks.size() && _chunks[next].size < size + alignment)
+        ++next;
+
+    if(next == _chunks.size())
+    {
+        // chunks double in size, so a frame settles on a handful of them
+        size_t chunkSize = _chunks.empty() ? _chunkSize : _chunks.back().size * 2;
+        chunkSize = max(chunkSize, size + alignment);
+
+        Chunk chunk;
+        chunk.data = (uint8_t*)AlignedAlloc(chunkSize, 64);
+        chunk.size = chunkSize;
+        _chunks.push_back(chunk);
+    }
+
+    _chunk = next;
+    _offset = 0;
+
+    return Allocate(size, alignment);
+}
+
+void* Arena::Reallocate(void* ptr, size_t oldSize, size_t newSize, size_t alignment)
+{
+    if(ptr && ptr == _last)
+    {
+        Chunk& chunk = _chunks[_chunk];
+        size_t offset = (uint8_t*)ptr - chunk.data;
+
+        if(offset + newSize <= chunk.size)
+        {
+            _offset = offset + newSize;
+            return ptr;
+        }
+    }
+
+    void* mem = Allocate(newSize, alignment);
+
+    if(ptr)
+        memcpy(mem, ptr, min(oldSize, newSize));
+
+    return mem;
+}
+
+void Arena::Reset()
+{
+    for(Destructor* dtor = _destructors; dtor; dtor = dtor->next)
+        dtor->destroy(dtor->obj);
+
+    _destructors = nullptr;
+    _chunk = 0;
+    _offset = 0;
+    _usedBefore = 0;
+    _last = nullptr;
+}
+
+void Arena::Reserve(size_t size)
+{
+    if(size == 0)
+        return;
+
+    for(auto& chunk : _chunks)
+    {
+        if(chunk.size >= size)
+            return;
+    }
+
+    // rounded up the same way the chunks grow, so reserving a little more each frame
+    // doesn't reallocate every time
+    size_t chunkSize = _chunkSize;
+    while(chunkSize < size)
+        chunkSize *= 2;
+
+    for(auto& chunk : _chunks)
+        AlignedFree(chunk.data);
+
+    _chunks.clear();
+
+    Chunk chunk;
+    chunk.data = (uint8_t*)AlignedAlloc(chunkSize, 64);
+    chunk.size = chunkSize;
+    _chunks.push_back(chunk);
+}
+
+size_t Arena::used() const {
+    return _usedBefore + _offset;
+}
+
+size_t Arena::capacity() const
+{
+    size_t total = 0;
+
+    for(auto& chunk : _chunks)
+        total += chunk.size;
+
+    return total;
+}
@@ -0,0 +1,98 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+using namespace std;
+
+// Linear allocator for data that only lives until the next Reset(). Allocations
+// bump a pointer through a list of chunks, and Reset() rewinds it in constant
+// time, keeping the chunks. Once the chunks have grown to what a frame needs,
+// allocating from the arena never touches the heap.
+//
+// An arena isn't thread safe. Threads allocating at the same time use one each.
+class Arena
+{
+public:
+    static constexpr size_t DefaultChunkSize = 64 * 1024;
+
+    explicit Arena(size_t chunkSize = DefaultChunkSize);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = 16);
+
+    // grows the last allocation in place when the chunk has room for it,
+    // otherwise moves it to a new chunk. 'ptr' may be null.
+    void* Reallocate(void* ptr, size_t oldSize, size_t newSize, size_t alignment = 16);
+
+    template<class T>
+    T* Allocate(size_t count) {
+        return (T*)Allocate(count * sizeof(T), alignof(T) > 16 ? alignof(T) : 16);
+    }
+
+    // constructs an object in the arena. its destructor, if it has one, runs on Reset()
+    template<class T, typename... Args>
+    T* New(Args&&... args)
+    {
+        Destructor* dtor = nullptr;
+        if(!is_trivially_destructible<T>::value)
+            dtor = (Destructor*)Allocate(sizeof(Destructor), alignof(Destructor));
+
+        T* obj = new (Allocate<T>(1)) T(std::forward<Args>(args)...);
+
+        if(dtor)
+        {
+            dtor->destroy = [](void* p){ ((T*)p)->~T(); };
+            dtor->obj = obj;
+            dtor->next = _destructors;
+            _destructors = dtor;
+        }
+
+        return obj;
+    }
+
+    // destroys the objects created with New() and makes all of the memory available again
+    void Reset();
+
+    // makes sure the arena can hand out 'size' bytes after a Reset() without touching
+    // the heap, replacing its chunks with a single bigger one if they're too small.
+    // the arena must be empty.
+    void Reserve(size_t size);
+
+    size_t used() const;
+    size_t capacity() const;
+
+private:
+    struct Chunk
+    {
+        uint8_t* data;
+        size_t size;
+    };
+
+    struct Destructor
+    {
+        void (*destroy)(void*);
+        void* obj;
+        Destructor* next;
+    };
+
+    void* AllocateFromNextChunk(size_t size, size_t alignment);
+
+    vector<Chunk> _chunks;
+    size_t _chunk;      // chunk being filled
+    size_t _offset;     // first free byte in it
+    size_t _usedBefore; // bytes used in the chunks before it
+    size_t _chunkSize;
+    void* _last;        // most recent allocation, which can grow in place
+    Destructor* _destructors;
+};
@@ -0,0 +1,176 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "Model.h"
+#include <algorithm>
+
+AssetLoader::AssetLoader(JobSystem& jobSystem, const shared_ptr<AssetPack>& assetPack)
+    : _jobSystem(jobSystem), _assetPack(assetPack), _pending(0)
+{
+    // shares the workers with the rendering contexts while they're both busy,
+    // so frames keep coming while the assets load
+    _group = _jobSystem.CreateGroup();
+}
+
+AssetLoader::~AssetLoader()
+{
+    _jobSystem.Wait(_jobs);
+    _jobSystem.ReleaseGroup(_group);
+}
+
+shared_ptr<AssetHandle<Texture>> AssetLoader::LoadTexture(const string& filename, FilterMode filterMode,
+                                                          function<void(const shared_ptr<Texture>&)> onLoaded)
+{
+    shared_ptr<AssetPack> assetPack = _assetPack;
+    JobSystem* jobSystem = &_jobSystem;
+
+    return Load<Texture>(filename, [assetPack, filename, filterMode, jobSystem]
+    {
+        shared_ptr<Texture> tex = assetPack ? assetPack->LoadTexture(filename, filterMode) : nullptr;
+        return tex ? tex : AlignedMakeShared<Texture, 16>(filename, filterMode, jobSystem);
+    },
+    move(onLoaded));
+}
+
+shared_ptr<AssetHandle<Model>> AssetLoader::LoadModel(const string& filename,
+                                                      function<void(const shared_ptr<Model>&)> onLoaded)
+{
+    shared_ptr<AssetPack> assetPack = _assetPack;
+    JobSystem* jobSystem = &_jobSystem;
+    bool pack = packModels;
+
+    return Load<Model>(filename, [assetPack, filename, jobSystem, pack]
+    {
+        shared_ptr<Model> model = assetPack ? assetPack->LoadModel(filename) : nullptr;
+        if(!model)
+            model = AlignedMakeShared<Model, 16>(filename, jobSystem);
+
+        if(pack)
+            model->Pack();
+
+        return model;
+    },
+    move(onLoaded));
+}
+
+template<class T>
+shared_ptr<AssetHandle<T>> AssetLoader::Load(const string& filename, function<shared_ptr<T>()> load,
+                                             function<void(const shared_ptr<T>&)> onLoaded)
+{
+    auto handle = make_shared<AssetHandle<T>>(filename);
+
+    _jobs.push_back(_jobSystem.Schedule([this, handle, load, onLoaded]
+    {
+        try {
+            handle->_asset = load();
+        }
+        catch(std::exception& ex) {
+            handle->_error = ex.what();
+        }
+        catch(...) {
+            handle->_error = "Unknown error.";
+        }
+
+        if(!handle->_asset && handle->_error.empty())
+            handle->_error = "Nothing was loaded.";
+
+        handle->_ready = true;
+
+        lock_guard<mutex> lk(_lock);
+        _finished.push_back([this, handle, onLoaded]
+        {
+            if(!handle->_asset)
+            {
+                if(onFailed)
+                    onFailed(handle->_filename, handle->_error);
+            }
+            else if(onLoaded)
+            {
+                onLoaded(handle->_asset);
+            }
+        });
+    },
+    _group));
+
+    ++_pending;
+    return handle;
+}
+
+bool AssetLoader::Update()
+{
+    // without any workers, the loads only run while someone waits on them,
+    // so one of them is run here each time
+    if(_jobSystem.threadCount() == 1)
+    {
+        for(auto& job : _jobs)
+        {
+            if(!job->IsDone())
+            {
+                _jobSystem.Wait(job);
+                break;
+            }
+        }
+    }
+
+    {
+        lock_guard<mutex> lk(_lock);
+        _callbacks.swap(_finished);
+    }
+
+    for(auto& callback : _callbacks)
+    {
+        callback();
+        --_pending;
+    }
+
+    _callbacks.clear();
+
+    // the finished jobs are waited on, so anything they threw isn't left behind,
+    // and dropped, so that a loader kept around to stream assets doesn't pile them up
+    auto last = remove_if(_jobs.begin(), _jobs.end(), [this](const JobHandle& job)
+    {
+        if(!job->IsDone())
+            return false;
+
+        _jobSystem.Wait(job);
+        return true;
+    });
+
+    _jobs.erase(last, _jobs.end());
+
+    return _pending == 0;
+}
+
+void AssetLoader::WaitAll()
+{
+    _jobSystem.Wait(_jobs);
+    Update();
+}
+
+size_t AssetLoader::pending() const {
+    return _pending;
+}
+
+const shared_ptr<Texture>& AssetLoader::PlaceholderTexture()
+{
+    static const Color32 gray(128, 128, 128, 255);
+    static const shared_ptr<Texture> texture = AlignedMakeShared<Texture, 16>(&gray, 1, 1, FilterMode::Point);
+    return texture;
+}
+
+const shared_ptr<Model>& AssetLoader::PlaceholderModel()
+{
+    static const shared_ptr<Model> model = []
+    {
+        auto model = AlignedMakeShared<Model, 16>();
+        model->bbox = Box(Vec3::zero, Vec3::zero);
+        model->bsphere = Sphere(Vec3::zero, 0.0f);
+        return model;
+    }();
+
+    return model;
+}
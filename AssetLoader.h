@@ -0,0 +1,113 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "JobSystem.h"
+#include "Texture.h"
+using namespace std;
+
+class AssetPack;
+class Model;
+
+// an asset that's loading in the background. asset() is null until ready() is true,
+// and stays null if it failed to load, in which case error() says why.
+template<class T>
+class AssetHandle
+{
+    friend class AssetLoader;
+
+    atomic<bool> _ready;
+    shared_ptr<T> _asset;
+    string _error;
+    string _filename;
+
+public:
+    AssetHandle(const string& filename) : _ready(false), _filename(filename){}
+
+    bool ready() const {
+        return _ready.load();
+    }
+
+    shared_ptr<T> asset() const {
+        return ready() ? _asset : nullptr;
+    }
+
+    const string& error() const {
+        static const string none;
+        return ready() ? _error : none;
+    }
+
+    const string& filename() const {
+        return _filename;
+    }
+};
+
+// Loads textures and models on the job system, each asset in a job of its own, so reading
+// one file overlaps with decoding another and all of them together take about as long as
+// the slowest one. Assets are looked for in the pack first, if there is one.
+//
+// The callbacks given to LoadTexture() and LoadModel() run on the thread that calls Update(),
+// so they can put the assets in the scene between frames. Until then, objects can be drawn
+// with the placeholders, which are never freed, so frames still in flight when they're
+// replaced can keep using them.
+class AssetLoader
+{
+public:
+    // models loaded from then on are packed in their jobs, see Model::Pack()
+    bool packModels = false;
+
+    // called from Update() with the filename and error of each asset that failed to load,
+    // instead of the asset's callback
+    function<void(const string& filename, const string& error)> onFailed;
+
+    AssetLoader(JobSystem& jobSystem, const shared_ptr<AssetPack>& assetPack = nullptr);
+    ~AssetLoader(); // waits for the loads that are still running
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    shared_ptr<AssetHandle<Texture>> LoadTexture(const string& filename, FilterMode filterMode,
+                                                 function<void(const shared_ptr<Texture>&)> onLoaded = nullptr);
+
+    shared_ptr<AssetHandle<Model>> LoadModel(const string& filename,
+                                             function<void(const shared_ptr<Model>&)> onLoaded = nullptr);
+
+    // runs the callbacks of the assets that finished loading since the last call.
+    // returns true once every asset has finished and its callback has run.
+    bool Update();
+
+    // blocks until everything has loaded, then calls Update()
+    void WaitAll();
+
+    // assets that haven't finished loading, or whose callbacks haven't run yet
+    size_t pending() const;
+
+    // a 1x1 gray texture
+    static const shared_ptr<Texture>& PlaceholderTexture();
+
+    // a model without any vertices, which isn't drawn, with empty bounds at the origin
+    static const shared_ptr<Model>& PlaceholderModel();
+
+private:
+    template<class T>
+    shared_ptr<AssetHandle<T>> Load(const string& filename, function<shared_ptr<T>()> load,
+                                    function<void(const shared_ptr<T>&)> onLoaded);
+
+    JobSystem& _jobSystem;
+    JobGroup* _group;
+    shared_ptr<AssetPack> _assetPack;
+    vector<JobHandle> _jobs;
+    size_t _pending;
+
+    mutex _lock;
+    vector<function<void()>> _finished; // callbacks of the assets that finished
+    vector<function<void()>> _callbacks;
+};
@@ -0,0 +1,359 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "AssetPack.h"
+#include "Model.h"
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    const uint32_t PackMagic = 0x4B415041; // "APAK"
+    const uint32_t PackVersion = 1;
+
+    // of the arrays in the file. the mapping starts on a page, so they stay aligned in memory.
+    const size_t DataAlignment = 64;
+
+    // the arrays and entries are written as they are in memory, so a pack
+    // is only read by builds with the same vertex and meshlet layouts
+    struct PackHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t vertexSize;
+        uint32_t meshletSize;
+        uint32_t modelCount;
+        uint32_t textureCount;
+        uint64_t modelsOffset;   // ModelEntry[modelCount]
+        uint64_t texturesOffset; // TextureEntry[textureCount]
+    };
+
+    struct ModelEntry
+    {
+        uint64_t nameOffset;
+        uint32_t nameSize;
+        uint32_t lodCount;
+        uint64_t vertexOffsets[Model::MaxLODs];
+        uint64_t vertexCounts[Model::MaxLODs];
+        uint64_t meshletOffsets[Model::MaxLODs];
+        uint64_t meshletCounts[Model::MaxLODs];
+        float bbox[6];
+        float bsphere[4];
+        float position[3];
+        float rotation[4];
+        float scale[3];
+        uint32_t hasLightmapCoords;
+        int32_t lightmapGridSize;
+    };
+
+    struct TextureEntry
+    {
+        uint64_t nameOffset;
+        uint32_t nameSize;
+        uint32_t channels;
+        uint32_t width;
+        uint32_t height;
+        uint64_t pixelOffset; // every mipmap, largest first, back to back
+    };
+
+    // the sizes of a texture's mipmaps, down to 1x1, the same way Texture makes them
+    vector<Mipmap> GetMipmaps(uint32_t width, uint32_t height)
+    {
+        vector<Mipmap> mipmaps;
+        int w = (int)width;
+        int h = (int)height;
+
+        while(true)
+        {
+            mipmaps.push_back(Mipmap{nullptr, w, h});
+
+            if(w == 1 && h == 1)
+                break;
+
+            if(w > 1) w >>= 1;
+            if(h > 1) h >>= 1;
+        }
+
+        return mipmaps;
+    }
+
+    uint64_t WriteAligned(ofstream& fout, const void* data, size_t size)
+    {
+        static const char zeros[DataAlignment] = {};
+
+        uint64_t offset = (uint64_t)fout.tellp();
+        size_t padding = (size_t)((DataAlignment - offset % DataAlignment) % DataAlignment);
+
+        fout.write(zeros, padding);
+        fout.write((const char*)data, size);
+        return offset + padding;
+    }
+
+    void CheckRange(uint64_t offset, uint64_t count, size_t elementSize, size_t size)
+    {
+        if(offset > size || count > (size - offset) / elementSize)
+            throw runtime_error("The asset pack is damaged.");
+    }
+}
+
+AssetPack::AssetPack(const string& filename)
+    : _file(filename), _data(_file.data()), _size(_file.size())
+{
+    ReadTables();
+}
+
+void AssetPack::ReadTables()
+{
+    if(_size < sizeof(PackHeader))
+        throw runtime_error("The asset pack is damaged.");
+
+    const PackHeader& header = *(const PackHeader*)_data;
+
+    if(header.magic != PackMagic)
+        throw runtime_error("The file isn't an asset pack.");
+
+    if(header.version != PackVersion || header.vertexSize != sizeof(Vertex) || header.meshletSize != sizeof(Meshlet))
+        throw runtime_error("The asset pack was written by a different build and has to be written again.");
+
+    CheckRange(header.modelsOffset, header.modelCount, sizeof(ModelEntry), _size);
+    CheckRange(header.texturesOffset, header.textureCount, sizeof(TextureEntry), _size);
+
+    // everything an entry points to is checked once here, so loading can trust it
+    const ModelEntry* models = (const ModelEntry*)(_data + header.modelsOffset);
+
+    for(uint32_t i = 0; i < header.modelCount; ++i)
+    {
+        const ModelEntry& entry = models[i];
+        CheckRange(entry.nameOffset, entry.nameSize, 1, _size);
+
+        if(entry.lodCount < 1 || entry.lodCount > (uint32_t)Model::MaxLODs)
+            throw runtime_error("The asset pack is damaged.");
+
+        for(uint32_t lod = 0; lod < entry.lodCount; ++lod)
+        {
+            CheckRange(entry.vertexOffsets[lod], entry.vertexCounts[lod], sizeof(Vertex), _size);
+            CheckRange(entry.meshletOffsets[lod], entry.meshletCounts[lod], sizeof(Meshlet), _size);
+        }
+
+        string name((const char*)_data + entry.nameOffset, entry.nameSize);
+        _models[name] = header.modelsOffset + i * sizeof(ModelEntry);
+    }
+
+    const TextureEntry* textures = (const TextureEntry*)(_data + header.texturesOffset);
+
+    for(uint32_t i = 0; i < header.textureCount; ++i)
+    {
+        const TextureEntry& entry = textures[i];
+        CheckRange(entry.nameOffset, entry.nameSize, 1, _size);
+
+        if(entry.width == 0 || entry.height == 0 || entry.width > 0x8000 || entry.height > 0x8000)
+            throw runtime_error("The asset pack is damaged.");
+
+        uint64_t pixelCount = 0;
+        for(auto& mipmap : GetMipmaps(entry.width, entry.height))
+            pixelCount += (uint64_t)mipmap.width * mipmap.height;
+
+        CheckRange(entry.pixelOffset, pixelCount, sizeof(Color32), _size);
+
+        string name((const char*)_data + entry.nameOffset, entry.nameSize);
+        _textures[name] = header.texturesOffset + i * sizeof(TextureEntry);
+    }
+}
+
+shared_ptr<Model> AssetPack::LoadModel(const string& name) const
+{
+    auto it = _models.find(name);
+    if(it == _models.end())
+        return nullptr;
+
+    const ModelEntry& entry = *(const ModelEntry*)(_data + it->second);
+
+    auto model = AlignedMakeShared<Model, 16>();
+    model->lods.resize(entry.lodCount - 1);
+    model->meshlets.resize(entry.lodCount);
+
+    for(uint32_t lod = 0; lod < entry.lodCount; ++lod)
+    {
+        const Vertex* vertices = (const Vertex*)(_data + entry.vertexOffsets[lod]);
+        const Meshlet* meshlets = (const Meshlet*)(_data + entry.meshletOffsets[lod]);
+
+        Model::VertexList& lodVertices = lod == 0 ? model->vertices : model->lods[lod - 1];
+        lodVertices.assign(vertices, vertices + entry.vertexCounts[lod]);
+        model->meshlets[lod].assign(meshlets, meshlets + entry.meshletCounts[lod]);
+    }
+
+    model->bbox = Box(Vec3(entry.bbox[0], entry.bbox[1], entry.bbox[2]),
+                      Vec3(entry.bbox[3], entry.bbox[4], entry.bbox[5]));
+    model->bsphere = Sphere(Vec3(entry.bsphere[0], entry.bsphere[1], entry.bsphere[2]), entry.bsphere[3]);
+
+    model->defaultTransfrom.SetPosition(entry.position[0], entry.position[1], entry.position[2]);
+    model->defaultTransfrom.SetRotation(Quat(entry.rotation[0], entry.rotation[1], entry.rotation[2], entry.rotation[3]));
+    model->defaultTransfrom.SetScale(entry.scale[0], entry.scale[1], entry.scale[2]);
+
+    model->hasLightmapCoords = entry.hasLightmapCoords != 0;
+    model->lightmapGridSize = entry.lightmapGridSize;
+
+    return model;
+}
+
+shared_ptr<Texture> AssetPack::LoadTexture(const string& name, FilterMode filterMode)
+{
+    auto it = _textures.find(name);
+    if(it == _textures.end())
+        return nullptr;
+
+    const TextureEntry& entry = *(const TextureEntry*)(_data + it->second);
+
+    // the texture never writes to its pixels, so they can stay in the read-only mapping
+    Color32* pixels = (Color32*)(_data + entry.pixelOffset);
+    vector<Mipmap> mipmaps = GetMipmaps(entry.width, entry.height);
+
+    for(auto& mipmap : mipmaps)
+    {
+        mipmap.pixels = pixels;
+        pixels += mipmap.width * mipmap.height;
+    }
+
+    return AlignedMakeShared<Texture, 16>(mipmaps, entry.channels, filterMode, shared_from_this());
+}
+
+size_t AssetPack::GetModelSize(const string& name) const
+{
+    auto it = _models.find(name);
+    if(it == _models.end())
+        return 0;
+
+    const ModelEntry& entry = *(const ModelEntry*)(_data + it->second);
+
+    size_t size = 0;
+    for(uint32_t lod = 0; lod < entry.lodCount; ++lod)
+        size += (size_t)(entry.vertexCounts[lod] * sizeof(Vertex) + entry.meshletCounts[lod] * sizeof(Meshlet));
+
+    return size;
+}
+
+size_t AssetPack::GetTextureSize(const string& name) const
+{
+    auto it = _textures.find(name);
+    if(it == _textures.end())
+        return 0;
+
+    const TextureEntry& entry = *(const TextureEntry*)(_data + it->second);
+
+    size_t size = 0;
+    for(auto& mipmap : GetMipmaps(entry.width, entry.height))
+        size += (size_t)mipmap.width * mipmap.height * sizeof(Color32);
+
+    return size;
+}
+
+void AssetPack::Write(const string& filename, const vector<string>& models, const vector<string>& textures,
+                      JobSystem* jobSystem)
+{
+    ofstream fout(filename, ios::out | ios::binary | ios::trunc);
+    if(!fout)
+        throw runtime_error("Failed to create '" + filename + "'.");
+
+    PackHeader header = {};
+    fout.write((const char*)&header, sizeof(header));
+
+    vector<ModelEntry> modelEntries;
+    vector<TextureEntry> textureEntries;
+
+    // the assets are loaded one at a time, so the pack can be larger than what fits in memory
+    for(auto& name : models)
+    {
+        auto model = AlignedMakeShared<Model, 16>(name, jobSystem);
+        if(model->vertices.empty())
+            throw runtime_error("Failed to load '" + name + "'.");
+
+        ModelEntry entry = {};
+        entry.lodCount = (uint32_t)model->lodCount();
+
+        for(int lod = 0; lod < model->lodCount(); ++lod)
+        {
+            auto& vertices = model->GetVertices(lod);
+            auto& meshlets = model->meshlets[lod];
+
+            entry.vertexOffsets[lod] = WriteAligned(fout, vertices.data(), vertices.size() * sizeof(Vertex));
+            entry.vertexCounts[lod] = vertices.size();
+            entry.meshletOffsets[lod] = WriteAligned(fout, meshlets.data(), meshlets.size() * sizeof(Meshlet));
+            entry.meshletCounts[lod] = meshlets.size();
+        }
+
+        Box& bbox = model->bbox;
+        Sphere& bsphere = model->bsphere;
+        Vec3 position = model->defaultTransfrom.GetPosition();
+        Quat rotation = model->defaultTransfrom.GetRotation();
+        Vec3 scale = model->defaultTransfrom.GetScale();
+
+        float values[] = {
+            bbox.vmin.x, bbox.vmin.y, bbox.vmin.z, bbox.vmax.x, bbox.vmax.y, bbox.vmax.z,
+            bsphere.center.x, bsphere.center.y, bsphere.center.z, bsphere.radius,
+            position.x, position.y, position.z,
+            rotation.v.x, rotation.v.y, rotation.v.z, rotation.w,
+            scale.x, scale.y, scale.z,
+        };
+
+        static_assert(sizeof(values) == offsetof(ModelEntry, hasLightmapCoords) - offsetof(ModelEntry, bbox),
+                      "The values have to match the entry's floats.");
+        memcpy(entry.bbox, values, sizeof(values));
+
+        entry.hasLightmapCoords = model->hasLightmapCoords ? 1 : 0;
+        entry.lightmapGridSize = model->lightmapGridSize;
+        modelEntries.push_back(entry);
+    }
+
+    for(auto& name : textures)
+    {
+        Texture texture(name, FilterMode::Point, jobSystem);
+
+        TextureEntry entry = {};
+        entry.channels = texture.channels();
+        entry.width = texture.width();
+        entry.height = texture.height();
+
+        // Texture keeps its mipmaps back to back, largest first
+        const Mipmap& first = texture.mipmap(0);
+        const Mipmap& last = texture.mipmap(texture.mipmapCount() - 1);
+        size_t pixelCount = (last.pixels + last.width * last.height) - first.pixels;
+
+        entry.pixelOffset = WriteAligned(fout, first.pixels, pixelCount * sizeof(Color32));
+        textureEntries.push_back(entry);
+    }
+
+    // the names go after the assets, then the entries pointing to both
+    for(size_t i = 0; i < models.size(); ++i)
+    {
+        modelEntries[i].nameOffset = (uint64_t)fout.tellp();
+        modelEntries[i].nameSize = (uint32_t)models[i].size();
+        fout.write(models[i].data(), models[i].size());
+    }
+
+    for(size_t i = 0; i < textures.size(); ++i)
+    {
+        textureEntries[i].nameOffset = (uint64_t)fout.tellp();
+        textureEntries[i].nameSize = (uint32_t)textures[i].size();
+        fout.write(textures[i].data(), textures[i].size());
+    }
+
+    header.magic = PackMagic;
+    header.version = PackVersion;
+    header.vertexSize = sizeof(Vertex);
+    header.meshletSize = sizeof(Meshlet);
+    header.modelCount = (uint32_t)modelEntries.size();
+    header.textureCount = (uint32_t)textureEntries.size();
+    header.modelsOffset = WriteAligned(fout, modelEntries.data(), modelEntries.size() * sizeof(ModelEntry));
+    header.texturesOffset = WriteAligned(fout, textureEntries.data(), textureEntries.size() * sizeof(TextureEntry));
+
+    // the header is written last, so a pack that wasn't finished can't be opened
+    fout.seekp(0);
+    fout.write((const char*)&header, sizeof(header));
+
+    if(!fout)
+        throw runtime_error("Failed to write '" + filename + "'.");
+}
@@ -0,0 +1,57 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "MappedFile.h"
+#include "Texture.h"
+using namespace std;
+
+class JobSystem;
+class Model;
+
+// A single file holding models and textures in the layout they have in memory, written
+// offline by Write(). Models come with their LODs and meshlets, and textures with all of
+// their mipmaps, so loading them takes no parsing, simplifying, decoding or mipmapping.
+//
+// The file is mapped into memory, and the pages of an asset are only read from disk once
+// it's used. Textures point straight into the mapping and keep the pack alive, so a pack has
+// to be owned by a shared_ptr. Models copy their arrays out of it, since they own their vertices.
+class AssetPack : public enable_shared_from_this<AssetPack>
+{
+public:
+    // throws runtime_error if the file can't be mapped, or wasn't written by this build
+    explicit AssetPack(const string& filename);
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // loads the models and textures from their files and writes them to a new pack.
+    // they're found in the pack by the filenames they're given here. the files are
+    // decoded on 'jobSystem', if there is one.
+    static void Write(const string& filename, const vector<string>& models, const vector<string>& textures,
+                      JobSystem* jobSystem = nullptr);
+
+    // null if the pack doesn't have it
+    shared_ptr<Model> LoadModel(const string& name) const;
+    shared_ptr<Texture> LoadTexture(const string& name, FilterMode filterMode);
+
+    // bytes the asset's arrays take once loaded, without loading it. 0 if the pack doesn't have it.
+    size_t GetModelSize(const string& name) const;
+    size_t GetTextureSize(const string& name) const;
+
+private:
+    void ReadTables();
+
+    MappedFile _file;
+    const uint8_t* _data;
+    size_t _size;
+    unordered_map<string, size_t> _models;   // entry offsets, by name
+    unordered_map<string, size_t> _textures;
+};
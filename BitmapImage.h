@@ -5,16 +5,47 @@
 
 #pragma once
 #include <cstdint>
+#include <cstdlib>
 #include <exception>
 #include <memory>
 #include <string>
-#include <fstream>
-#include <Windows.h>
+#include <cstring>
+#include <stdexcept>
+#include "ColorConversion.h"
+#include "JobSystem.h"
+#include "MappedFile.h"
 #include "Math.h"
 using namespace std;
 
 class BitmapImage
 {
+    // same layout as the BITMAPFILEHEADER and BITMAPINFOHEADER of the Windows SDK
+#pragma pack(push, 2)
+    struct FileHeader
+    {
+        uint16_t bfType;
+        uint32_t bfSize;
+        uint16_t bfReserved1;
+        uint16_t bfReserved2;
+        uint32_t bfOffBits;
+    };
+#pragma pack(pop)
+
+    struct InfoHeader
+    {
+        uint32_t biSize;
+        int32_t biWidth;
+        int32_t biHeight;
+        uint16_t biPlanes;
+        uint16_t biBitCount;
+        uint32_t biCompression;
+        uint32_t biSizeImage;
+        int32_t biXPelsPerMeter;
+        int32_t biYPelsPerMeter;
+        uint32_t biClrUsed;
+        uint32_t biClrImportant;
+    };
+
 public:
     unique_ptr<Color32[]> pixels;
     int width = 0;
@@ -24,73 +55,97 @@ public:
     BitmapImage(unique_ptr<Color32[]>&& pixels, int width, int height, int channels)
         : pixels(std::forward<unique_ptr<Color32[]>>(pixels)), width(width), height(height), channels(channels){}
 
-    static BitmapImage Load(const string& filename)
+    // the size of the image in a BMP file in memory.
+    // throws runtime_error if it isn't an image that can be decoded.
+    static void ReadInfo(const uint8_t* data, size_t size, int& width, int& height, int& channels)
     {
-        ifstream fin(filename, ios::in | ios::binary);
-        if(!fin)
-            throw runtime_error("failed to load file");
+        FileHeader fileHeader;
+        InfoHeader infoHeader;
+        ReadHeaders(data, size, fileHeader, infoHeader);
 
-        BITMAPFILEHEADER fileHeader;
-        BITMAPINFOHEADER infoHeader;
+        width = infoHeader.biWidth;
+        height = abs(infoHeader.biHeight);
+        channels = infoHeader.biBitCount >> 3;
+    }
 
-        fin.read((char*)&fileHeader, sizeof(BITMAPFILEHEADER));
-        union {
-            WORD w;
-            char c[2];
-        } type = { fileHeader.bfType };
+    // decodes a BMP file in memory into 'pixels', which has room for the whole image, top row first.
+    // rows are written straight to where they go, in bands of rows on 'jobSystem' for large images, if there is one.
+    static void Decode(const uint8_t* data, size_t size, Color32* pixels, JobSystem* jobSystem = nullptr)
+    {
+        FileHeader fileHeader;
+        InfoHeader infoHeader;
+        ReadHeaders(data, size, fileHeader, infoHeader);
 
-        if(memcmp(type.c, "BM", 2) != 0)
-            throw runtime_error("Invalid bitmap format. Only windows bitmaps are supported.");
+        int bytesPerPixel = infoHeader.biBitCount >> 3;
+        int w = infoHeader.biWidth;
+        int h = abs(infoHeader.biHeight);
+        bool bottomUp = infoHeader.biHeight > 0;
 
-        fin.read((char*)&infoHeader, sizeof(BITMAPINFOHEADER));
+        // rows are padded to 4 bytes
+        size_t stride = ((size_t)w * bytesPerPixel + 3) & ~(size_t)3;
+        size_t dataOffset = fileHeader.bfOffBits;
 
-        if(infoHeader.biSize != sizeof(BITMAPINFOHEADER))
-            throw runtime_error("Failed to read bitmap info header. File may be corrupt.");
+        if(dataOffset > size || stride * (h - 1) + (size_t)w * bytesPerPixel > size - dataOffset)
+            throw runtime_error("Failed to read bitmap pixels. File may be corrupt.");
 
-        if(infoHeader.biCompression > 0)
-            throw runtime_error("Invalid bitmap format. Compression is not supported.");
+        // images smaller than a few bands aren't worth splitting up
+        const size_t MinBandPixels = 64 * 1024;
+        size_t bandCount = jobSystem ? min((size_t)w * h / MinBandPixels, jobSystem->threadCount() * 4) : 1;
+        int bandRows = bandCount > 1 ? (int)((h + bandCount - 1) / bandCount) : h;
 
-        if(infoHeader.biBitCount != 24 && infoHeader.biBitCount != 32)
-            throw runtime_error("Invalid bitmap format. Only 24 bit bitmaps are supported.");
+        auto decodeRows = [=](size_t band)
+        {
+            int y1 = (int)band * bandRows;
+            int y2 = min(y1 + bandRows, h);
 
-        int bytesPerPixel = infoHeader.biBitCount >> 3;
-        auto w = infoHeader.biWidth;
-        auto h = infoHeader.biHeight;
+            for(int y = y1; y < y2; ++y)
+            {
+                Color32* row = pixels + (size_t)(bottomUp ? h - 1 - y : y) * w;
+                ColorConversion::Convert(data + dataOffset + y * stride, bytesPerPixel, row, w);
+            }
+        };
 
-        int stride = w * bytesPerPixel;
-        int padding = (stride % 4) > 0 ? 4 - (stride % 4) : 0;
+        if(bandRows < h)
+            jobSystem->ParallelFor((h + bandRows - 1) / bandRows, decodeRows);
+        else
+            decodeRows(0);
+    }
 
-        unique_ptr<Color32[]> ret = make_unique<Color32[]>(w * h);
+    static BitmapImage Load(const string& filename, JobSystem* jobSystem = nullptr)
+    {
+        MappedFile file(filename);
 
-        DWORD dataOffset = fileHeader.bfOffBits;
-        size_t pos = (size_t)fin.tellg();
+        int w, h, channels;
+        ReadInfo(file.data(), file.size(), w, h, channels);
 
-        if(pos < dataOffset)
-            fin.ignore(dataOffset - pos);
+        unique_ptr<Color32[]> ret = make_unique<Color32[]>((size_t)w * h);
+        Decode(file.data(), file.size(), ret.get(), jobSystem);
 
-        Color32* r = ret.get() + w * h - w;
+        return { std::forward<unique_ptr<Color32[]>>(ret), w, h, channels };
+    }
 
-        for(int y = h - 1; y >= 0; --y)
-        {
-            Color32* p = r;
+private:
+    static void ReadHeaders(const uint8_t* data, size_t size, FileHeader& fileHeader, InfoHeader& infoHeader)
+    {
+        if(size < sizeof(FileHeader) + sizeof(InfoHeader))
+            throw runtime_error("Invalid bitmap format. Only windows bitmaps are supported.");
 
-            for(int x = 0; x < w; ++x)
-            {
-                ColorBGRA bgra;
+        memcpy(&fileHeader, data, sizeof(FileHeader));
+        memcpy(&infoHeader, data + sizeof(FileHeader), sizeof(InfoHeader));
 
-                fin.read((char*)&bgra, bytesPerPixel);
-                if(bytesPerPixel == 3)
-                    bgra.a = 255;
+        if(memcmp(data, "BM", 2) != 0)
+            throw runtime_error("Invalid bitmap format. Only windows bitmaps are supported.");
 
-                *p++ = Color32(bgra);
-            }
+        if(infoHeader.biSize != sizeof(InfoHeader))
+            throw runtime_error("Failed to read bitmap info header. File may be corrupt.");
 
-            if(padding > 0)
-                fin.ignore(padding);
+        if(infoHeader.biCompression > 0)
+            throw runtime_error("Invalid bitmap format. Compression is not supported.");
 
-            r -= w;
-        }
+        if(infoHeader.biBitCount != 24 && infoHeader.biBitCount != 32)
+            throw runtime_error("Invalid bitmap format. Only 24 bit bitmaps are supported.");
 
-        return { std::forward<unique_ptr<Color32[]>>(ret), w, h, bytesPerPixel };
+        if(infoHeader.biWidth <= 0 || infoHeader.biHeight == 0)
+            throw runtime_error("Invalid bitmap format. The image is empty.");
     }
 };
@@ -0,0 +1,279 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "BoundingVolumeHierarchy.h"
+#include "Model.h"
+#include "SceneObject.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+static bool Equal(const Box& a, const Box& b)
+{
+    return a.vmin.x == b.vmin.x && a.vmin.y == b.vmin.y && a.vmin.z == b.vmin.z
+        && a.vmax.x == b.vmax.x && a.vmax.y == b.vmax.y && a.vmax.z == b.vmax.z;
+}
+
+static float GetComponent(const Vec3& v, int axis) {
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+{
+    _builtArea = 0;
+}
+
+void BoundingVolumeHierarchy::Update(const vector<shared_ptr<SceneObject>>& objects)
+{
+    if(objects.size() != _entries.size())
+    {
+        Rebuild(objects);
+        return;
+    }
+
+    bool refitted = false;
+
+    for(size_t i = 0; i < objects.size(); ++i)
+    {
+        const shared_ptr<SceneObject>& obj = objects[i];
+        Entry& entry = _entries[i];
+
+        if(!IsSame(entry, obj))
+        {
+            Rebuild(objects);
+            return;
+        }
+
+        if(entry.transformVersion != obj->transform.GetVersion()
+        || entry.model != obj->model.get()
+        || entry.modelVersion != obj->model->GetVersion())
+        {
+            Record(entry, obj);
+            _spheres[i] = obj->GetWorldBoundingSphere();
+            Refit(entry.leaf);
+            refitted = true;
+        }
+    }
+
+    if(refitted && GetArea(_nodes[0].bounds) > _builtArea * RebuildGrowth)
+        Rebuild(objects);
+}
+
+void BoundingVolumeHierarchy::Cull(const Plane* planes, int planeCount, vector<uint32_t>& indices) const
+{
+    if(_nodes.empty())
+        return;
+
+    size_t start = indices.size();
+
+    // nodes are visited with the planes they aren't entirely in front of.
+    // once there are none left, everything below the node is inside.
+    uint32_t stack[MaxDepth];
+    uint32_t masks[MaxDepth];
+    int top = 0;
+
+    stack[top] = 0;
+    masks[top++] = (uint32_t)((1ull << planeCount) - 1);
+
+    while(top > 0)
+    {
+        --top;
+        const Node& node = _nodes[stack[top]];
+        uint32_t mask = masks[top];
+
+        Vec3 center = (node.bounds.vmin + node.bounds.vmax) * 0.5f;
+        Vec3 extent = (node.bounds.vmax - node.bounds.vmin) * 0.5f;
+        bool culled = false;
+
+        for(int p = 0; p < planeCount; ++p)
+        {
+            if(!(mask & (1u << p)))
+                continue;
+
+            const Plane& plane = planes[p];
+            float dist = plane.Distance(center);
+            float radius = extent.x * fabs(plane.a) + extent.y * fabs(plane.b) + extent.z * fabs(plane.c);
+
+            if(dist < -radius)
+            {
+                culled = true;
+                break;
+            }
+
+            if(dist >= radius)
+                mask &= ~(1u << p);
+        }
+
+        if(culled)
+            continue;
+
+        if(node.child != None && mask != 0)
+        {
+            stack[top] = node.child;
+            masks[top++] = mask;
+            stack[top] = node.child + 1;
+            masks[top++] = mask;
+            continue;
+        }
+
+        for(uint32_t k = node.first; k < node.first + node.count; ++k)
+        {
+            uint32_t index = _order[k];
+            const Sphere& sphere = _spheres[index];
+
+            if(sphere.radius < FLT_EPSILON)
+                continue;
+
+            bool visible = true;
+
+            for(int p = 0; p < planeCount && visible; ++p)
+            {
+                if(mask & (1u << p))
+                    visible = !planes[p].InBack(sphere);
+            }
+
+            if(visible)
+                indices.push_back(index);
+        }
+    }
+
+    sort(indices.begin() + start, indices.end());
+}
+
+const Sphere& BoundingVolumeHierarchy::GetSphere(uint32_t index) const {
+    return _spheres[index];
+}
+
+void BoundingVolumeHierarchy::Rebuild(const vector<shared_ptr<SceneObject>>& objects)
+{
+    uint32_t count = (uint32_t)objects.size();
+
+    _entries.resize(count);
+    _spheres.resize(count);
+    _order.resize(count);
+    _nodes.clear();
+
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        Record(_entries[i], objects[i]);
+        _spheres[i] = objects[i]->GetWorldBoundingSphere();
+        _order[i] = i;
+    }
+
+    _builtArea = 0;
+
+    if(count == 0)
+        return;
+
+    _nodes.resize(1);
+    _nodes[0].parent = None;
+    Build(0, 0, count);
+
+    _builtArea = GetArea(_nodes[0].bounds);
+}
+
+void BoundingVolumeHierarchy::Build(uint32_t node, uint32_t first, uint32_t count)
+{
+    _nodes[node].first = first;
+    _nodes[node].count = count;
+    _nodes[node].child = None;
+
+    if(count <= LeafSize)
+    {
+        _nodes[node].bounds = GetBounds(first, count);
+
+        for(uint32_t k = first; k < first + count; ++k)
+            _entries[_order[k]].leaf = node;
+
+        return;
+    }
+
+    // split at the median of the centers along the axis they're most spread out on
+    Vec3 cmin(FLT_MAX, FLT_MAX, FLT_MAX);
+    Vec3 cmax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+    for(uint32_t k = first; k < first + count; ++k)
+    {
+        const Vec3& c = _spheres[_order[k]].center;
+        cmin = Vec3(min(cmin.x, c.x), min(cmin.y, c.y), min(cmin.z, c.z));
+        cmax = Vec3(max(cmax.x, c.x), max(cmax.y, c.y), max(cmax.z, c.z));
+    }
+
+    Vec3 spread = cmax - cmin;
+    int axis = spread.x > spread.y ? (spread.x > spread.z ? 0 : 2) : (spread.y > spread.z ? 1 : 2);
+
+    uint32_t half = count / 2;
+    auto begin = _order.begin() + first;
+
+    nth_element(begin, begin + half, begin + count, [this, axis](uint32_t a, uint32_t b){
+        return GetComponent(_spheres[a].center, axis) < GetComponent(_spheres[b].center, axis);
+    });
+
+    uint32_t child = (uint32_t)_nodes.size();
+    _nodes.resize(child + 2);
+    _nodes[node].child = child;
+    _nodes[child].parent = node;
+    _nodes[child + 1].parent = node;
+
+    Build(child, first, half);
+    Build(child + 1, first + half, count - half);
+
+    _nodes[node].bounds = _nodes[child].bounds;
+    _nodes[node].bounds += _nodes[child + 1].bounds;
+}
+
+void BoundingVolumeHierarchy::Refit(uint32_t node)
+{
+    Box bounds = GetBounds(_nodes[node].first, _nodes[node].count);
+
+    // stops where the bounds of a node stay the same, since the ones above it won't change either
+    while(!Equal(bounds, _nodes[node].bounds))
+    {
+        _nodes[node].bounds = bounds;
+        node = _nodes[node].parent;
+
+        if(node == None)
+            break;
+
+        bounds = _nodes[_nodes[node].child].bounds;
+        bounds += _nodes[_nodes[node].child + 1].bounds;
+    }
+}
+
+Box BoundingVolumeHierarchy::GetBounds(uint32_t first, uint32_t count) const
+{
+    Box bounds(Vec3(FLT_MAX, FLT_MAX, FLT_MAX), Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+
+    for(uint32_t k = first; k < first + count; ++k)
+    {
+        const Sphere& sphere = _spheres[_order[k]];
+        Vec3 radius(sphere.radius, sphere.radius, sphere.radius);
+        bounds += Box(sphere.center - radius, sphere.center + radius);
+    }
+
+    return bounds;
+}
+
+void BoundingVolumeHierarchy::Record(Entry& entry, const shared_ptr<SceneObject>& obj)
+{
+    entry.owner = obj;
+    entry.obj = obj.get();
+    entry.model = obj->model.get();
+    entry.modelVersion = obj->model->GetVersion();
+    entry.transformVersion = obj->transform.GetVersion();
+}
+
+bool BoundingVolumeHierarchy::IsSame(const Entry& entry, const shared_ptr<SceneObject>& obj)
+{
+    return entry.obj == obj.get()
+        && !entry.owner.owner_before(obj)
+        && !obj.owner_before(entry.owner);
+}
+
+float BoundingVolumeHierarchy::GetArea(const Box& box)
+{
+    Vec3 size = box.vmax - box.vmin;
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
@@ -0,0 +1,83 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Math.h"
+using namespace std;
+
+class Model;
+class SceneObject;
+
+// Bounding volume hierarchy over the world bounding spheres of a scene's objects,
+// so that culling only looks at the objects in the parts of the scene it can see.
+//
+// Objects are referred to by their index in the scene's object list. The tree is
+// rebuilt when objects are added, removed or reordered. When an object moves or its
+// model changes, only the nodes above it are refitted, until refitting has loosened
+// the tree enough that rebuilding it pays off.
+class BoundingVolumeHierarchy
+{
+public:
+    // most objects in a leaf
+    static constexpr uint32_t LeafSize = 4;
+
+    // the tree is rebuilt once refitting has grown the surface area of the root this much
+    static constexpr float RebuildGrowth = 2.0f;
+
+    BoundingVolumeHierarchy();
+
+    // catches up with the changes to 'objects' since the last update
+    void Update(const vector<shared_ptr<SceneObject>>& objects);
+
+    // appends the indices of the objects whose bounding sphere isn't entirely behind any of
+    // 'planes' in increasing order, so the same as testing each object with Plane::InBack.
+    // objects with an empty bounding sphere are left out. at most 32 planes.
+    void Cull(const Plane* planes, int planeCount, vector<uint32_t>& indices) const;
+
+    // bounding sphere of an object as of the last update
+    const Sphere& GetSphere(uint32_t index) const;
+
+private:
+    static constexpr uint32_t None = UINT32_MAX;
+
+    // nodes waiting to be visited while culling. splitting at the median keeps the tree well below this
+    static constexpr int MaxDepth = 64;
+
+    struct Node
+    {
+        Box bounds;
+        uint32_t parent;
+        uint32_t child; // the first of two children, which are next to each other. None for leaves
+        uint32_t first; // the objects below the node are _order[first, first + count)
+        uint32_t count;
+    };
+
+    struct Entry
+    {
+        weak_ptr<SceneObject> owner; // another object may be allocated in the place of one that's gone
+        const SceneObject* obj;
+        const Model* model;
+        uint32_t modelVersion;
+        uint32_t transformVersion;
+        uint32_t leaf;
+    };
+
+    void Rebuild(const vector<shared_ptr<SceneObject>>& objects);
+    void Build(uint32_t node, uint32_t first, uint32_t count);
+    void Refit(uint32_t node);
+    Box GetBounds(uint32_t first, uint32_t count) const;
+    static void Record(Entry& entry, const shared_ptr<SceneObject>& obj);
+    static bool IsSame(const Entry& entry, const shared_ptr<SceneObject>& obj);
+    static float GetArea(const Box& box);
+
+    vector<Entry> _entries;  // by object index
+    vector<Sphere> _spheres; // by object index
+    vector<uint32_t> _order; // object indices, with the ones below each node next to each other
+    vector<Node> _nodes;     // the root is first
+    float _builtArea;        // surface area of the root when the tree was built
+};
@@ -14,6 +14,7 @@ Camera::Camera()
     
     _updateProjection = true;
     _updateView = true;
+    _version = 0;
 
     transform.AddObserver(this);
 }
@@ -27,6 +28,7 @@ Camera::Camera(float fov, float aspect, float zNear, float zFar)
     
     _updateProjection = true;
     _updateView = true;
+    _version = 0;
 
     transform.AddObserver(this);
 }
@@ -35,29 +37,63 @@ void Camera::SetFieldOfView(float fov)
 {
     _fov = fov;
     _updateProjection = true;
+    ++_version;
 }
 
 void Camera::SetAspectRatio(float aspect)
 {
     _aspect = aspect;
     _updateProjection = true;
+    ++_version;
 }
 
 void Camera::SetNearPlane(float zNear)
 {
     _nearPlane = zNear;
     _updateProjection = true;
+    ++_version;
 }
 
 void Camera::SetFarPlane(float zFar)
 {
     _farPlane = zFar;
     _updateProjection = true;
+    ++_version;
+}
+
+float Camera::GetFieldOfView() const
+{
+    return _fov;
+}
+
+float Camera::GetAspectRatio() const
+{
+    return _aspect;
+}
+
+float Camera::GetNearPlane() const
+{
+    return _nearPlane;
+}
+
+float Camera::GetFarPlane() const
+{
+    return _farPlane;
 }
 
 void Camera::OnTransformChanged(Transform *sender)
 {
     _updateView = true;
+    ++_version;
+}
+
+uint32_t Camera::GetVersion() const {
+    return _version;
+}
+
+const Mat4 &Camera::GetViewMatrix() const
+{
+    return transform.GetInverseMatrix();
 }
 
 const Mat4 &Camera::GetVPMatrix() const
@@ -124,6 +160,12 @@ void Camera::Update() const
     _updateProjection = false;
 }
 
+const Plane *Camera::GetFrustumPlanes() const
+{
+    Update();
+    return _frustum;
+}
+
 bool Camera::CanSee(const Sphere &bounds)
 {
     Update();
@@ -139,3 +181,15 @@ bool Camera::CanSee(const Sphere &bounds)
 
     return true;
 }
+
+float Camera::GetScreenSize(const Sphere &bounds) const
+{
+    float dist = bounds.center.Distance(transform.GetPosition());
+
+    if(dist <= bounds.radius)
+        return FLT_MAX;
+
+    // see Mat4::Project3D
+    float scaleY = _aspect / tan(Math::DegToRad * _fov * 0.5f);
+    return bounds.radius * scaleY / dist;
+}
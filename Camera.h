@@ -30,19 +30,35 @@ public:
     void SetAspectRatio(float aspect);
     void SetNearPlane(float zNear);
     void SetFarPlane(float zFar);
+
+    float GetFieldOfView() const;
+    float GetAspectRatio() const;
+    float GetNearPlane() const;
+    float GetFarPlane() const;
     
     virtual void OnTransformChanged(Transform *sender);
 
+    const Mat4 &GetViewMatrix() const;
     const Mat4 &GetVPMatrix() const;
     const Mat4 &GetProjectionMatrix() const;
     bool CanSee(const Sphere &bounds);
 
+    // projected diameter of 'bounds' over the height of the screen, FLT_MAX if the camera is inside it
+    float GetScreenSize(const Sphere &bounds) const;
+
+    // in world space, facing inwards, in the order of FrustumPlanes
+    const Plane *GetFrustumPlanes() const;
+
+    // incremented every time the view or projection changes
+    uint32_t GetVersion() const;
+
 private:
     Mat4 _matrix;
     float _fov;
     float _aspect;
     float _nearPlane;
     float _farPlane;
+    uint32_t _version;
     
     mutable bool _updateProjection;
     mutable bool _updateView;
@@ -0,0 +1,89 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "ColorConversion.h"
+#include "SIMD.h"
+#include <cstring>
+
+namespace
+{
+    void ConvertBGR(const uint8_t* src, Color32* dst, size_t count)
+    {
+#if USE_SSE
+        // 4 pixels are 12 bytes. 16 pixels are three whole loads, which are
+        // realigned so that each vector starts on a pixel.
+        const __m128i shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+        const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+
+        for(; count >= 16; count -= 16, src += 48, dst += 16)
+        {
+            __m128i v0 = _mm_loadu_si128((const __m128i*)src);
+            __m128i v1 = _mm_loadu_si128((const __m128i*)(src + 16));
+            __m128i v2 = _mm_loadu_si128((const __m128i*)(src + 32));
+
+            __m128i p0 = v0;
+            __m128i p1 = _mm_alignr_epi8(v1, v0, 12);
+            __m128i p2 = _mm_alignr_epi8(v2, v1, 8);
+            __m128i p3 = _mm_srli_si128(v2, 4);
+
+            _mm_storeu_si128((__m128i*)dst,        _mm_or_si128(_mm_shuffle_epi8(p0, shuffle), alpha));
+            _mm_storeu_si128((__m128i*)(dst + 4),  _mm_or_si128(_mm_shuffle_epi8(p1, shuffle), alpha));
+            _mm_storeu_si128((__m128i*)(dst + 8),  _mm_or_si128(_mm_shuffle_epi8(p2, shuffle), alpha));
+            _mm_storeu_si128((__m128i*)(dst + 12), _mm_or_si128(_mm_shuffle_epi8(p3, shuffle), alpha));
+        }
+#endif
+
+        for(; count > 0; --count, src += 3)
+            *dst++ = ColorConversion::Read(src, 3);
+    }
+
+    void ConvertBGRA(const uint8_t* src, Color32* dst, size_t count)
+    {
+#if USE_SSE
+        const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+        for(; count >= 16; count -= 16, src += 64, dst += 16)
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i*)(src + i * 16));
+                _mm_storeu_si128((__m128i*)(dst + i * 4), _mm_shuffle_epi8(v, shuffle));
+            }
+        }
+#endif
+
+        for(; count > 0; --count, src += 4)
+            *dst++ = ColorConversion::Read(src, 4);
+    }
+}
+
+void ColorConversion::Convert(const uint8_t* src, int bytesPerPixel, Color32* dst, size_t count)
+{
+    if(bytesPerPixel == 4)
+        ConvertBGRA(src, dst, count);
+    else
+        ConvertBGR(src, dst, count);
+}
+
+void ColorConversion::Fill(Color32* dst, Color32 color, size_t count)
+{
+#if USE_SSE
+    uint32_t value;
+    memcpy(&value, &color, sizeof(value));
+
+    const __m128i v = _mm_set1_epi32((int)value);
+
+    for(; count >= 16; count -= 16, dst += 16)
+    {
+        _mm_storeu_si128((__m128i*)dst, v);
+        _mm_storeu_si128((__m128i*)(dst + 4), v);
+        _mm_storeu_si128((__m128i*)(dst + 8), v);
+        _mm_storeu_si128((__m128i*)(dst + 12), v);
+    }
+#endif
+
+    for(; count > 0; --count)
+        *dst++ = color;
+}
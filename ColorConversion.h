@@ -0,0 +1,26 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Math.h"
+using namespace std;
+
+// Converts runs of pixels as image files store them, in BGR or BGRA order, to Color32.
+// Whole groups of 16 pixels are swizzled with SSSE3 shuffles if USE_SSE is set, the rest one at a time.
+// None of them read past the end of the source, so they can run right up to the end of a mapped file.
+class ColorConversion
+{
+public:
+    // 'bytesPerPixel' is 3 for BGR, which gets an alpha of 255, or 4 for BGRA
+    static void Convert(const uint8_t* src, int bytesPerPixel, Color32* dst, size_t count);
+
+    static void Fill(Color32* dst, Color32 color, size_t count);
+
+    static Color32 Read(const uint8_t* src, int bytesPerPixel) {
+        return Color32(src[2], src[1], src[0], bytesPerPixel == 4 ? src[3] : 255);
+    }
+};
@@ -5,15 +5,16 @@
 
 #pragma once
 #include "Shader.h"
+#include "InstancedObject.h"
 #include "Texture.h"
 #include "Math.h"
 #include "Camera.h"
 #include "Scene.h"
 #include "SceneObject.h"
 #include "Light.h"
+#include "LightmapBaker.h"
 #include <memory>
 #include <vector>
-#include "static_vector.h"
 
 // a pixel lit shader used for rendering all models
 class LitShader : public Shader
@@ -27,10 +28,16 @@ public:
     Vec3 eyePos = Vec3::zero;
     Vec3 eyeDir = Vec3::zero;
     bool enableLighting = true;
-    static_vector<Light*, 5> lights;
+    const LightClusters* lightClusters = nullptr;
 
-    virtual void CopyTo(ShaderList& copies) override {
-        copies.push_back(*this);
+    // objects covering less of the screen height than this are lit per vertex. they only
+    // return to per pixel lighting once they grow past vertexLightingSize * lodHysteresis,
+    // so objects near the threshold don't keep popping between the two.
+    float vertexLightingSize = 0.1f;
+    float lodHysteresis = 1.5f;
+
+    virtual shared_ptr<Shader> Clone() const override {
+        return AlignedMakeShared<LitShader, 16>(*this);
     }
 
     virtual void Prepare(Scene* scene, SceneObject* obj) override
@@ -42,26 +49,38 @@ public:
         mtxNormal = obj->transform.GetInverseMatrix().Transposed();
         eyePos = scene->camera->transform.GetPosition();
         eyeDir = Vec3::forward * scene->camera->transform.GetRotation();
-        int channels = texture->channels();
-
-        lights.clear();
+        lightClusters = scene->lightClusters.get();
+        vertexLighting = enableLighting && SelectVertexLighting(scene, obj);
 
-        for(auto& light : scene->lights)
-        {
-            if(light->CanAffect(obj->GetWorldBoundingSphere())) {
-                lights.push_back(light.get());
-            }
-        }
+        // vertices can be off screen, where the clusters don't have all of the lights
+        // reaching them, so they're lit by the lights that can reach the object instead
+        if(vertexLighting)
+            lightList = scene->lightClusters->GatherLights(obj->GetWorldBoundingSphere());
     }
 
-    virtual Vertex ProcessVertex(const Vertex &in) override
+    // instances are lit per pixel, since the lighting LOD is picked for the whole shader
+    virtual bool PrepareInstanced(Scene* scene, InstancedObject* obj) override
     {
-        Vertex out;
-        out.position = Vec4(in.position, 1.0f) * mtxMVP;
-        out.normal = Vec4(in.normal, 1.0f) * mtxNormal;
-        out.texcoord = in.texcoord;
-        out.worldPos = Vec4(in.worldPos, 1.0f) * mtxModel;
-        return out;
+        this->scene = scene;
+        texture = obj->texture.get();
+        eyePos = scene->camera->transform.GetPosition();
+        eyeDir = Vec3::forward * scene->camera->transform.GetRotation();
+        lightClusters = scene->lightClusters.get();
+        vertexLighting = false;
+        return true;
+    }
+
+    virtual Vertex ProcessVertex(const Vertex &in) override {
+        return TransformVertex(in, mtxModel, mtxMVP, mtxNormal);
+    }
+
+    virtual Vertex ProcessVertex(const Vertex &in, const InstanceData &instance) override {
+        return TransformVertex(in, instance.mtxModel, instance.mtxMVP, instance.mtxNormal);
+    }
+
+    // per vertex lighting changes with the lights, and is prepared again every frame
+    virtual bool cacheableVertices() const override {
+        return !vertexLighting;
     }
 
     virtual Color ProcessPixel(const Vertex &in, float mipLevel, bool& discard) override
@@ -73,27 +92,68 @@ public:
             if(texture->channels() == 4 && tex.a > 0.5f)
                 return tex;
 
-            Color lum = Color::black;
-            Vec3 normal = in.normal.Normalized();
-
-            for(auto& light : lights)
-                lum += light->Apply(in.worldPos, normal, eyePos, eyeDir);
-
-            return tex * lum;
+            return tex * GetLighting(in);
         }
         else
         {
             return tex;
         }
     }
+
+protected:
+    bool vertexLighting = false;
+    uint32_t lightList = 0; // from LightClusters::GatherLights(), while vertex lit
+
+    // false if the lighting from static lights comes from elsewhere (a lightmap)
+    bool staticLighting = true;
+
+    Vertex TransformVertex(const Vertex &in, const Mat4 &model, const Mat4 &mvp, const Mat4 &normal) const
+    {
+        Vertex out;
+        out.position = Vec4(in.position, 1.0f) * mvp;
+        out.normal = Vec4(in.normal, 1.0f) * normal;
+        out.texcoord = in.texcoord;
+        out.lightmapCoord = in.lightmapCoord;
+        out.worldPos = Vec4(in.worldPos, 1.0f) * model;
+
+        // vertex lit pixels don't need the normal, so the lighting is interpolated in its place
+        if(vertexLighting)
+        {
+            Color lum = lightClusters->IlluminateGathered(lightList, out.worldPos, out.normal.Normalized(), staticLighting);
+            out.normal = Vec3(lum.r, lum.g, lum.b);
+        }
+
+        return out;
+    }
+
+    Color Illuminate(const Vertex &in) const {
+        return lightClusters->Illuminate(in.worldPos, in.normal.Normalized(), staticLighting);
+    }
+
+    Color GetLighting(const Vertex &in) const
+    {
+        if(vertexLighting)
+            return Color(in.normal.x, in.normal.y, in.normal.z, 1.0f);
+
+        return Illuminate(in);
+    }
+
+    // lighting LOD, picks per vertex lighting from the object's projected size
+    bool SelectVertexLighting(Scene* scene, SceneObject* obj) const
+    {
+        float size = scene->camera->GetScreenSize(obj->GetWorldBoundingSphere());
+        float threshold = obj->vertexLit ? vertexLightingSize * lodHysteresis : vertexLightingSize;
+        obj->vertexLit = size < threshold;
+        return obj->vertexLit;
+    }
 };
 
 class LitCutoutShader : public LitShader
 {
 public:
 
-    virtual void CopyTo(ShaderList& copies) override {
-        copies.push_back(*this);
+    virtual shared_ptr<Shader> Clone() const override {
+        return AlignedMakeShared<LitCutoutShader, 16>(*this);
     }
 
     virtual Color ProcessPixel(const Vertex &in, float mipLevel, bool& discard) override
@@ -107,13 +167,7 @@ public:
 
         if(enableLighting)
         {
-            Color lum = Color::black;
-            Vec3 normal = in.normal.Normalized();
-
-            for(auto& light : lights)
-                lum += light->Apply(in.worldPos, normal, eyePos, eyeDir);
-
-            return tex * lum;
+            return tex * GetLighting(in);
         }
         else
         {
@@ -122,6 +176,48 @@ public:
     }
 };
 
+// a pixel lit shader for static objects, which takes the lighting from static
+// lights out of the object's lightmap and only evaluates dynamic lights per pixel
+class LitLightmappedShader : public LitShader
+{
+public:
+    Texture* lightmap = nullptr;
+
+    virtual shared_ptr<Shader> Clone() const override {
+        return AlignedMakeShared<LitLightmappedShader, 16>(*this);
+    }
+
+    virtual void Prepare(Scene* scene, SceneObject* obj) override
+    {
+        lightmap = obj->lightmap.get();
+        staticLighting = lightmap == nullptr;
+        LitShader::Prepare(scene, obj);
+    }
+
+    // instances don't have lightmaps
+    virtual bool PrepareInstanced(Scene* scene, InstancedObject* obj) override
+    {
+        lightmap = nullptr;
+        staticLighting = true;
+        return LitShader::PrepareInstanced(scene, obj);
+    }
+
+    virtual Color ProcessPixel(const Vertex &in, float mipLevel, bool& discard) override
+    {
+        Color tex = texture->GetPixel(in.texcoord, mipLevel);
+
+        if(!enableLighting)
+            return tex;
+
+        Color lum = GetLighting(in);
+
+        if(lightmap)
+            lum += lightmap->GetBilinear(in.lightmapCoord) * LightmapBaker::Range;
+
+        return tex * lum;
+    }
+};
+
 // a self-illuminated shader used to render the sky
 class UnlitShader : public Shader
 {
@@ -129,8 +225,8 @@ public:
     Texture* texture;
     Mat4 mtxMVP;
 
-    virtual void CopyTo(ShaderList& copies) override {
-        copies.push_back(*this);
+    virtual shared_ptr<Shader> Clone() const override {
+        return AlignedMakeShared<UnlitShader, 16>(*this);
     }
 
     virtual void Prepare(Scene* scene, SceneObject* obj) override
@@ -139,6 +235,12 @@ public:
         mtxMVP = obj->transform.GetMatrix() * scene->camera->GetVPMatrix();
     }
 
+    virtual bool PrepareInstanced(Scene* scene, InstancedObject* obj) override
+    {
+        texture = obj->texture.get();
+        return true;
+    }
+
     virtual Vertex ProcessVertex(const Vertex &in) override
     {
         Vertex out;
@@ -147,6 +249,14 @@ public:
         return out;
     }
 
+    virtual Vertex ProcessVertex(const Vertex &in, const InstanceData &instance) override
+    {
+        Vertex out;
+        out.position = Vec4(in.position, 1.0f) * instance.mtxMVP;
+        out.texcoord = in.texcoord;
+        return out;
+    }
+
     virtual Color ProcessPixel(const Vertex &in, float mipLevel, bool& discard) override {
         return texture->GetPixel(in.texcoord, mipLevel);
     }
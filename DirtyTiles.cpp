@@ -0,0 +1,585 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "DirtyTiles.h"
+#include "Camera.h"
+#include "InstancedObject.h"
+#include "Model.h"
+#include "RenderingContext.h"
+#include "Scene.h"
+#include "SceneObject.h"
+#include <algorithm>
+#include <cstring>
+
+static bool Equal(const Vec3& a, const Vec3& b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+static bool Equal(const Color& a, const Color& b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+DirtyTiles::DirtyTiles()
+{
+    _valid = false;
+    _scene = nullptr;
+    _camera = nullptr;
+    _cameraVersion = 0;
+    _width = 0;
+    _height = 0;
+    _renderWidth = 0;
+    _renderHeight = 0;
+    _nearPlane = 0;
+    _tilesX = 0;
+    _tilesY = 0;
+}
+
+void DirtyTiles::Invalidate() {
+    _valid = false;
+}
+
+bool DirtyTiles::Update(Scene& scene, const DrawCall* drawCalls, size_t drawCallCount,
+                        int width, int height, int renderWidth, int renderHeight, vector<Rect>& rects)
+{
+    const Camera& camera = *scene.camera;
+
+    bool whole = !_valid
+              || _scene != &scene
+              || _camera != &camera
+              || _cameraVersion != camera.GetVersion()
+              || _width != width
+              || _height != height
+              || _renderWidth != renderWidth
+              || _renderHeight != renderHeight;
+
+    _valid = true;
+    _scene = &scene;
+    _camera = &camera;
+    _cameraVersion = camera.GetVersion();
+    _width = width;
+    _height = height;
+    _renderWidth = renderWidth;
+    _renderHeight = renderHeight;
+    _mtxView = camera.GetViewMatrix();
+    _mtxProjection = camera.GetProjectionMatrix();
+    _nearPlane = camera.GetNearPlane();
+
+    _tilesX = (width + TileSize - 1) / TileSize;
+    _tilesY = (height + TileSize - 1) / TileSize;
+    _tiles.assign(_tilesX * _tilesY, 0);
+
+    swap(_objects, _lastObjects);
+    swap(_lights, _lastLights);
+    AddObjects(scene, drawCalls, drawCallCount);
+    AddLights(scene);
+
+    if(whole)
+        return false;
+
+    bool localLightsChanged = false;
+    bool shadowsChanged = false;
+
+    if(!CompareLights(localLightsChanged, shadowsChanged))
+        return false;
+
+    if(!CompareObjects(localLightsChanged || shadowsChanged, shadowsChanged))
+        return false;
+
+    GetRects(rects);
+    return true;
+}
+
+void DirtyTiles::AddObjects(Scene& scene, const DrawCall* drawCalls, size_t drawCallCount)
+{
+    _objects.clear();
+
+    // the draw calls are in the same order as the objects they came from
+    size_t d = 0;
+
+    for(auto& obj : scene.objects)
+    {
+        ObjectRecord record;
+        record.obj = obj.get();
+        record.owner = obj;
+        record.transformVersion = obj->transform.GetVersion();
+        record.model = obj->model.get();
+        record.modelVersion = obj->model->GetVersion();
+        record.lod = (uint32_t)obj->lod;
+        record.shader = obj->shader.get();
+        record.shaderVersion = obj->shader->version();
+        record.texture = obj->texture.get();
+        record.lightmap = obj->lightmap.get();
+        record.cullMode = (int)obj->cullMode;
+        record.castShadows = obj->castShadows;
+        record.visible = false;
+        record.lightDependent = false;
+        record.bounds = Rect(0, 0, 0, 0);
+        record.sphere = obj->GetWorldBoundingSphere();
+
+        if(d < drawCallCount && drawCalls[d].obj == obj.get())
+        {
+            record.visible = true;
+            record.lightDependent = !drawCalls[d].shader->cacheableVertices();
+            record.bounds = drawCalls[d].bounds;
+            ++d;
+
+            Vec3 corners[8];
+            obj->model->bbox.GetVerts(corners);
+            const Mat4& mtxModel = obj->transform.GetMatrix();
+
+            for(int i = 0; i < 8; ++i)
+            {
+                Vec3 p = Vec4(corners[i], 1.0f) * mtxModel;
+                Box corner(p, p);
+
+                if(i == 0)
+                    record.box = corner;
+                else
+                    record.box += corner;
+            }
+        }
+
+        _objects.push_back(move(record));
+    }
+
+    // followed by a run of draw calls for each instanced object, one per instance in view
+    for(auto& obj : scene.instancedObjects)
+    {
+        ObjectRecord record;
+        record.obj = obj.get();
+        record.owner = obj;
+        record.transformVersion = obj->GetVersion();
+        record.model = obj->model.get();
+        record.modelVersion = obj->model->GetVersion();
+        record.lod = obj->GetLODVersion();
+        record.shader = obj->shader.get();
+        record.shaderVersion = obj->shader->version();
+        record.texture = obj->texture.get();
+        record.lightmap = nullptr;
+        record.cullMode = (int)obj->cullMode;
+        record.castShadows = obj->castShadows;
+        record.visible = false;
+        record.lightDependent = false;
+        record.bounds = Rect(0, 0, 0, 0);
+        record.sphere = obj->GetWorldBoundingSphere();
+
+        for(; d < drawCallCount && drawCalls[d].instanced == obj.get(); ++d)
+        {
+            record.visible = true;
+            record.lightDependent = record.lightDependent || !drawCalls[d].shader->cacheableVertices();
+            record.bounds = Rect::Union(record.bounds, drawCalls[d].bounds);
+        }
+
+        if(record.visible)
+            record.box = obj->GetWorldBounds();
+
+        _objects.push_back(move(record));
+    }
+
+    sort(_objects.begin(), _objects.end(), [](const ObjectRecord& a, const ObjectRecord& b){ return a.obj < b.obj; });
+}
+
+void DirtyTiles::AddLights(Scene& scene)
+{
+    _lights.clear();
+
+    for(auto& light : scene.lights)
+    {
+        LightRecord record;
+        record.light = light.get();
+        record.type = light->type();
+        record.isStatic = light->isStatic;
+        record.castShadows = false;
+        record.color = Color::clear;
+        record.position = Vec3::zero;
+        record.direction = Vec3::zero;
+        record.sphere = Sphere(Vec3::zero, 0);
+        fill(begin(record.attenuation), end(record.attenuation), 0.0f);
+        fill(begin(record.shadowMaps), end(record.shadowMaps), nullptr);
+
+        switch(record.type)
+        {
+        case LightType::Ambient:
+        {
+            auto ambient = (AmbientLight*)light.get();
+            record.color = ambient->color * ambient->intensity;
+            break;
+        }
+        case LightType::Directional:
+        {
+            auto directional = (DirectionalLight*)light.get();
+            record.color = directional->color * directional->intensity;
+            record.direction = directional->direction;
+            record.castShadows = directional->castShadows;
+
+            if(directional->castShadows)
+            {
+                auto buffers = directional->shadowMap.buffers();
+                for(int i = 0; i < CascadedShadowMap::CascadeCount; ++i)
+                    record.shadowMaps[i] = buffers.cascades[i];
+            }
+            break;
+        }
+        case LightType::Point:
+        {
+            auto point = (PointLight*)light.get();
+            record.color = point->color * point->intensity;
+            record.position = point->position;
+            record.attenuation[0] = point->distAttenMin;
+            record.attenuation[1] = point->distAttenMax;
+            record.sphere = point->GetBoundingSphere();
+            break;
+        }
+        case LightType::Spot:
+        {
+            auto spot = (SpotLight*)light.get();
+            record.color = spot->color * spot->intensity;
+            record.position = spot->position;
+            record.direction = spot->direction;
+            record.attenuation[0] = spot->angAttenMin;
+            record.attenuation[1] = spot->angAttenMax;
+            record.attenuation[2] = spot->distAttenMin;
+            record.attenuation[3] = spot->distAttenMax;
+            record.castShadows = spot->castShadows;
+            record.sphere = spot->GetBoundingSphere();
+
+            if(spot->castShadows)
+                record.shadowMaps[0] = &spot->shadowMap.buffer();
+            break;
+        }
+        }
+
+        _lights.push_back(record);
+    }
+}
+
+bool DirtyTiles::CompareLights(bool& localLightsChanged, bool& shadowsChanged)
+{
+    if(_lights.size() != _lastLights.size())
+        return false;
+
+    for(size_t i = 0; i < _lights.size(); ++i)
+    {
+        const LightRecord& a = _lastLights[i];
+        const LightRecord& b = _lights[i];
+
+        if(a.light != b.light || a.type != b.type)
+            return false;
+
+        bool same = a.isStatic == b.isStatic
+                 && a.castShadows == b.castShadows
+                 && Equal(a.color, b.color)
+                 && Equal(a.position, b.position)
+                 && Equal(a.direction, b.direction)
+                 && memcmp(a.attenuation, b.attenuation, sizeof(a.attenuation)) == 0;
+
+        bool sameShadows = memcmp(a.shadowMaps, b.shadowMaps, sizeof(a.shadowMaps)) == 0;
+
+        if(same && sameShadows)
+            continue;
+
+        if(same)
+        {
+            // the shadow map was rendered again for casters that
+            // moved, and their shadows are marked along with them
+            shadowsChanged = true;
+        }
+        else if(b.type == LightType::Point || b.type == LightType::Spot)
+        {
+            if(!MarkSphere(a.sphere) || !MarkSphere(b.sphere))
+                return false;
+
+            localLightsChanged = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DirtyTiles::CompareObjects(bool lightsChanged, bool shadowsChanged)
+{
+    // shadows of directional lights fall somewhere on the objects in view
+    bool first = true;
+
+    for(auto* records : { &_lastObjects, &_objects })
+    {
+        for(auto& record : *records)
+        {
+            if(!record.visible)
+                continue;
+
+            if(first)
+                _visibleBounds = record.box;
+            else
+                _visibleBounds += record.box;
+
+            first = false;
+        }
+    }
+
+    bool castersChanged = false;
+
+    // both lists are sorted by object, so a walk through them finds
+    // the objects that stayed, and the ones that came or went
+    auto last = _lastObjects.begin();
+    auto current = _objects.begin();
+
+    while(last != _lastObjects.end() || current != _objects.end())
+    {
+        const ObjectRecord* a = nullptr;
+        const ObjectRecord* b = nullptr;
+
+        if(current == _objects.end() || (last != _lastObjects.end() && last->obj < current->obj))
+        {
+            a = &*last++;
+        }
+        else if(last == _lastObjects.end() || current->obj < last->obj)
+        {
+            b = &*current++;
+        }
+        else
+        {
+            a = &*last++;
+            b = &*current++;
+        }
+
+        bool changed = !a || !b
+                    || a->owner.expired()
+                    || a->transformVersion != b->transformVersion
+                    || a->model != b->model
+                    || a->modelVersion != b->modelVersion
+                    || a->lod != b->lod
+                    || a->shader != b->shader
+                    || a->shaderVersion != b->shaderVersion
+                    || a->texture != b->texture
+                    || a->lightmap != b->lightmap
+                    || a->cullMode != b->cullMode
+                    || a->castShadows != b->castShadows
+                    || a->visible != b->visible;
+
+        if(changed)
+        {
+            if(!MarkChangedObject(a, b, shadowsChanged))
+                return false;
+
+            if((a && a->castShadows) || (b && b->castShadows))
+                castersChanged = true;
+        }
+        else if(lightsChanged && b->lightDependent)
+        {
+            MarkRect(b->bounds);
+        }
+    }
+
+    // the shadow maps changed for some other reason
+    if(shadowsChanged && !castersChanged)
+        return false;
+
+    return true;
+}
+
+bool DirtyTiles::MarkChangedObject(const ObjectRecord* last, const ObjectRecord* current, bool shadowsChanged)
+{
+    for(const ObjectRecord* record : { last, current })
+    {
+        if(!record)
+            continue;
+
+        if(record->visible)
+            MarkRect(record->bounds);
+
+        if(!shadowsChanged || !record->castShadows)
+            continue;
+
+        // objects in view can be affected by shadows from outside of it
+        if(!MarkShadow(record->sphere))
+            return false;
+    }
+
+    return true;
+}
+
+bool DirtyTiles::MarkShadow(const Sphere& caster)
+{
+    // a little bigger for the filtering of the shadow maps
+    float radius = caster.radius * 1.1f;
+
+    for(auto& light : _lights)
+    {
+        if(!light.castShadows)
+            continue;
+
+        if(light.type == LightType::Directional)
+        {
+            // the shadow is the caster swept along the light's direction. it falls on
+            // the objects in view at the most, so it ends where it leaves their bounds.
+            float length = GetExitDistance(caster.center, light.direction);
+            Vec3 end = caster.center + light.direction * length;
+
+            if(!MarkSphere(Sphere(caster.center, radius)) || !MarkSphere(Sphere(end, radius)))
+                return false;
+        }
+        else if(light.type == LightType::Spot)
+        {
+            float range = light.attenuation[3];
+            Vec3 toCaster = caster.center - light.position;
+            float dist = toCaster.Length();
+
+            if(dist - caster.radius > range)
+                continue;
+
+            if(dist <= caster.radius)
+            {
+                if(!MarkSphere(light.sphere))
+                    return false;
+
+                continue;
+            }
+
+            // the shadow widens away from the light, and ends where the light does
+            Vec3 dir = toCaster / dist;
+            float length = Math::Min(GetExitDistance(caster.center, dir), Math::Max(range - dist, 0.0f));
+            Vec3 end = caster.center + dir * length;
+
+            if(!MarkSphere(Sphere(caster.center, radius)) || !MarkSphere(Sphere(end, radius * (dist + length) / dist)))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+float DirtyTiles::GetExitDistance(const Vec3& origin, const Vec3& direction) const
+{
+    float pos[3] = { origin.x, origin.y, origin.z };
+    float dir[3] = { direction.x, direction.y, direction.z };
+    float lo[3] = { _visibleBounds.vmin.x, _visibleBounds.vmin.y, _visibleBounds.vmin.z };
+    float hi[3] = { _visibleBounds.vmax.x, _visibleBounds.vmax.y, _visibleBounds.vmax.z };
+    float exit = FLT_MAX;
+
+    for(int i = 0; i < 3; ++i)
+    {
+        if(abs(dir[i]) > FLT_EPSILON)
+            exit = Math::Min(exit, Math::Max((lo[i] - pos[i]) / dir[i], (hi[i] - pos[i]) / dir[i]));
+        else if(pos[i] < lo[i] || pos[i] > hi[i])
+            exit = 0;
+    }
+
+    return Math::Max(exit, 0.0f);
+}
+
+bool DirtyTiles::MarkSphere(const Sphere& sphere)
+{
+    Vec3 center = Vec4(sphere.center, 1.0f) * _mtxView;
+    float r = sphere.radius;
+
+    // the corners of a box around the sphere are projected, which only works in front of the camera
+    if(center.z - r <= _nearPlane)
+        return false;
+
+    float minX = FLT_MAX, minY = FLT_MAX;
+    float maxX = -FLT_MAX, maxY = -FLT_MAX;
+
+    for(int i = 0; i < 8; ++i)
+    {
+        Vec3 corner(center.x + ((i & 1) ? r : -r),
+                    center.y + ((i & 2) ? r : -r),
+                    center.z + ((i & 4) ? r : -r));
+
+        Vec4 clip = Vec4(corner, 1.0f) * _mtxProjection;
+        float x = (clip.x / clip.w + 1.0f) * 0.5f * (float)_renderWidth;
+        float y = (float)_renderHeight - (clip.y / clip.w + 1.0f) * 0.5f * (float)_renderHeight;
+
+        minX = Math::Min(minX, x);
+        minY = Math::Min(minY, y);
+        maxX = Math::Max(maxX, x);
+        maxY = Math::Max(maxY, y);
+    }
+
+    // off screen entirely
+    if(maxX < 0 || maxY < 0 || minX > (float)_renderWidth || minY > (float)_renderHeight)
+        return true;
+
+    minX = Math::Max(minX, 0.0f);
+    minY = Math::Max(minY, 0.0f);
+    maxX = Math::Min(maxX, (float)_renderWidth);
+    maxY = Math::Min(maxY, (float)_renderHeight);
+
+    int x0 = Math::Floor(minX);
+    int y0 = Math::Floor(minY);
+    MarkRect(Rect(x0, y0, Math::Ceil(maxX) - x0 + 1, Math::Ceil(maxY) - y0 + 1));
+    return true;
+}
+
+void DirtyTiles::MarkRect(const Rect& rect)
+{
+    if(rect.IsEmpty())
+        return;
+
+    // tiles are in pixels of the final image, and a pixel more is taken on each
+    // side for the rounding of triangle edges and the filtering of the resolve
+    int scale = _renderWidth / _width;
+    int tileSize = TileSize * scale;
+
+    int x0 = Math::Max((rect.x - 1) / tileSize, 0);
+    int y0 = Math::Max((rect.y - 1) / tileSize, 0);
+    int x1 = Math::Min((rect.x + rect.w + 1) / tileSize, _tilesX - 1);
+    int y1 = Math::Min((rect.y + rect.h + 1) / tileSize, _tilesY - 1);
+
+    for(int y = y0; y <= y1; ++y)
+    {
+        for(int x = x0; x <= x1; ++x)
+            _tiles[y * _tilesX + x] = 1;
+    }
+}
+
+void DirtyTiles::GetRects(vector<Rect>& rects) const
+{
+    int scale = _renderWidth / _width;
+    int tileSize = TileSize * scale;
+
+    rects.clear();
+
+    // runs of dirty tiles in each row, merged with the same run in the rows above
+    for(int y = 0; y < _tilesY; ++y)
+    {
+        for(int x = 0; x < _tilesX; )
+        {
+            if(!_tiles[y * _tilesX + x])
+            {
+                ++x;
+                continue;
+            }
+
+            int start = x;
+            while(x < _tilesX && _tiles[y * _tilesX + x])
+                ++x;
+
+            int rx = start * tileSize;
+            int ry = y * tileSize;
+            int rw = Math::Min(x * tileSize, _renderWidth) - rx;
+            int rh = Math::Min((y + 1) * tileSize, _renderHeight) - ry;
+
+            bool merged = false;
+
+            for(size_t i = 0; i < rects.size() && !merged; ++i)
+            {
+                Rect& above = rects[i];
+                if(above.x == rx && above.w == rw && above.y + above.h == ry)
+                {
+                    above.h += rh;
+                    merged = true;
+                }
+            }
+
+            if(!merged)
+                rects.push_back(Rect(rx, ry, rw, rh));
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Math.h"
+#include "Light.h"
+using namespace std;
+
+class Camera;
+class Model;
+class Scene;
+class SceneObject;
+class Shader;
+class Texture;
+struct DrawCall;
+
+// Keeps track of what went into the last frame, so that the next one only has to
+// render the tiles of the screen that something changed in and can keep the rest.
+//
+// An object that moved, or whose shader, texture, model or LOD changed, dirties the tiles
+// its triangles covered before and cover now. A point or spot light that changed
+// dirties the tiles its sphere of influence covers, and a shadow caster that moved
+// dirties the tiles its shadows can fall on.
+// Anything else, like the camera moving, needs the whole frame rendered.
+class DirtyTiles
+{
+public:
+    // in pixels of the final image
+    static constexpr int TileSize = 32;
+
+    DirtyTiles();
+
+    // the next frame is rendered whole
+    void Invalidate();
+
+    // compares the frame about to be rendered with the last one. returns false if it has to be
+    // rendered whole, otherwise 'rects' gets the parts that changed, in render target pixels.
+    bool Update(Scene& scene, const DrawCall* drawCalls, size_t drawCallCount,
+                int width, int height, int renderWidth, int renderHeight, vector<Rect>& rects);
+
+private:
+    struct ObjectRecord
+    {
+        const void* obj;   // a SceneObject or an InstancedObject
+        weak_ptr<void> owner; // another object may be allocated in the place of one that's gone
+        uint32_t transformVersion; // or the version of the instances
+        const Model* model;
+        uint32_t modelVersion;
+        uint32_t lod;              // or the version of the instances' LODs
+        const Shader* shader;
+        uint32_t shaderVersion;
+        const Texture* texture;
+        const Texture* lightmap;
+        int cullMode;
+        bool castShadows;
+        bool visible;
+        bool lightDependent; // lit per vertex, so any change to the lights changes all of it
+        Rect bounds;         // of its triangles, if visible
+        Box box;             // of its model in world space, if visible
+        Sphere sphere;
+    };
+
+    struct LightRecord
+    {
+        const Light* light;
+        LightType type;
+        bool isStatic;
+        bool castShadows;
+        Color color;
+        Vec3 position;
+        Vec3 direction;
+        float attenuation[4];
+        const void* shadowMaps[CascadedShadowMap::CascadeCount];
+        Sphere sphere;
+    };
+
+    void AddObjects(Scene& scene, const DrawCall* drawCalls, size_t drawCallCount);
+    void AddLights(Scene& scene);
+    bool CompareLights(bool& localLightsChanged, bool& shadowsChanged);
+    bool CompareObjects(bool lightsChanged, bool shadowsChanged);
+    bool MarkChangedObject(const ObjectRecord* last, const ObjectRecord* current, bool shadowsChanged);
+    bool MarkShadow(const Sphere& caster);
+    float GetExitDistance(const Vec3& origin, const Vec3& direction) const; // from the bounds of the objects in view
+    bool MarkSphere(const Sphere& sphere);
+    void MarkRect(const Rect& rect);
+    void GetRects(vector<Rect>& rects) const;
+
+    bool _valid;
+    const Scene* _scene;
+    const Camera* _camera;
+    uint32_t _cameraVersion;
+    int _width;
+    int _height;
+    int _renderWidth;
+    int _renderHeight;
+
+    Mat4 _mtxView;
+    Mat4 _mtxProjection;
+    float _nearPlane;
+    Box _visibleBounds; // of the objects on screen in both frames, where shadows can fall
+
+    vector<ObjectRecord> _objects;
+    vector<ObjectRecord> _lastObjects;
+    vector<LightRecord> _lights;
+    vector<LightRecord> _lastLights;
+
+    int _tilesX;
+    int _tilesY;
+    vector<uint8_t> _tiles;
+};
@@ -0,0 +1,374 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "FbxFile.h"
+#include "JobSystem.h"
+#include "Zlib.h"
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace
+{
+    const char Magic[] = "Kaydara FBX Binary  \0\x1a\0";
+    const size_t MagicSize = sizeof(Magic) - 1;
+    const size_t HeaderSize = MagicSize + 4;
+
+    // the data is little endian, like the machines this runs on
+    template<class T>
+    T ReadValue(const uint8_t* data)
+    {
+        T value;
+        memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    void CheckSize(size_t offset, size_t size, size_t end)
+    {
+        if(offset > end || size > end - offset)
+            throw runtime_error("The FBX file is damaged.");
+    }
+
+    size_t GetElementSize(char type)
+    {
+        switch(type)
+        {
+        case 'b': return 1;
+        case 'i': case 'f': return 4;
+        case 'l': case 'd': return 8;
+        default:  return 0;
+        }
+    }
+
+    template<class T>
+    void ConvertArray(const FbxFile::Property& property, vector<T>& values)
+    {
+        const uint8_t* data = property.data;
+        values.resize(property.count);
+
+        switch(property.type)
+        {
+        case 'b':
+            for(size_t i = 0; i < property.count; ++i)
+                values[i] = (T)data[i];
+            break;
+
+        case 'i':
+            for(size_t i = 0; i < property.count; ++i)
+                values[i] = (T)ReadValue<int32_t>(data + i * 4);
+            break;
+
+        case 'l':
+            for(size_t i = 0; i < property.count; ++i)
+                values[i] = (T)ReadValue<int64_t>(data + i * 8);
+            break;
+
+        case 'f':
+            for(size_t i = 0; i < property.count; ++i)
+                values[i] = (T)ReadValue<float>(data + i * 4);
+            break;
+
+        case 'd':
+            for(size_t i = 0; i < property.count; ++i)
+                values[i] = (T)ReadValue<double>(data + i * 8);
+            break;
+
+        default:
+            if(property.data)
+            {
+                values.clear();
+            }
+            else
+            {
+                values.resize(1);
+                values[0] = is_floating_point<T>::value ? (T)property.doubleValue : (T)property.intValue;
+            }
+            break;
+        }
+    }
+}
+
+bool FbxFile::Property::isArray() const {
+    return GetElementSize(type) != 0;
+}
+
+int64_t FbxFile::Property::AsInt() const {
+    return intValue;
+}
+
+double FbxFile::Property::AsDouble() const {
+    return doubleValue;
+}
+
+string FbxFile::Property::AsString() const {
+    return (type == 'S' || type == 'R') ? string((const char*)data, size) : string();
+}
+
+void FbxFile::Property::GetArray(vector<double>& values) const {
+    ConvertArray(*this, values);
+}
+
+void FbxFile::Property::GetArray(vector<int32_t>& values) const {
+    ConvertArray(*this, values);
+}
+
+const FbxFile::Node* FbxFile::Node::Find(const string& name) const
+{
+    for(auto& child : children)
+    {
+        if(child.name == name)
+            return &child;
+    }
+
+    return nullptr;
+}
+
+FbxFile::FbxFile(const string& filename, JobSystem* jobSystem)
+    : _version(0)
+{
+    ifstream fin(filename, ios::in | ios::binary | ios::ate);
+    if(!fin)
+        throw runtime_error("Failed to open '" + filename + "'.");
+
+    _data.resize((size_t)fin.tellg());
+    fin.seekg(0);
+    fin.read((char*)_data.data(), _data.size());
+
+    if(!fin)
+        throw runtime_error("Failed to read '" + filename + "'.");
+
+    if(_data.size() < HeaderSize || memcmp(_data.data(), Magic, MagicSize) != 0)
+        throw runtime_error("'" + filename + "' isn't a binary FBX file.");
+
+    _version = ReadValue<uint32_t>(&_data[MagicSize]);
+
+    if(_version < 7000 || _version >= 8000)
+        throw runtime_error("Version " + to_string(_version) + " FBX files aren't supported.");
+
+    size_t offset = HeaderSize;
+    ReadNodes(offset, _data.size(), _root.children);
+
+    InflateArrays(jobSystem);
+}
+
+uint32_t FbxFile::version() const {
+    return _version;
+}
+
+const FbxFile::Node& FbxFile::root() const {
+    return _root;
+}
+
+void FbxFile::ReadNodes(size_t& offset, size_t end, vector<Node>& nodes)
+{
+    // the offsets and counts grew to 64 bits in 7.5
+    bool wide = _version >= 7500;
+    size_t recordSize = wide ? 25 : 13;
+
+    while(offset < end)
+    {
+        CheckSize(offset, recordSize, end);
+
+        const uint8_t* record = &_data[offset];
+        uint64_t nodeEnd = wide ? ReadValue<uint64_t>(record) : ReadValue<uint32_t>(record);
+        uint64_t propertyCount = wide ? ReadValue<uint64_t>(record + 8) : ReadValue<uint32_t>(record + 4);
+        uint64_t propertyListSize = wide ? ReadValue<uint64_t>(record + 16) : ReadValue<uint32_t>(record + 8);
+        size_t nameSize = record[recordSize - 1];
+
+        offset += recordSize;
+
+        // a record of zeros ends the list
+        if(nodeEnd == 0)
+            return;
+
+        if(nodeEnd < offset || nodeEnd > end)
+            throw runtime_error("The FBX file is damaged.");
+
+        CheckSize(offset, nameSize, (size_t)nodeEnd);
+        CheckSize(offset + nameSize, (size_t)propertyListSize, (size_t)nodeEnd);
+
+        // every property takes at least two bytes
+        if(propertyCount > propertyListSize / 2)
+            throw runtime_error("The FBX file is damaged.");
+
+        nodes.emplace_back();
+        Node& node = nodes.back();
+
+        node.name.assign((const char*)&_data[offset], nameSize);
+        offset += nameSize;
+
+        size_t propertiesEnd = offset + (size_t)propertyListSize;
+        node.properties.resize((size_t)propertyCount);
+
+        for(auto& property : node.properties)
+            ReadProperty(offset, propertiesEnd, property);
+
+        offset = propertiesEnd;
+
+        if(offset < nodeEnd)
+            ReadNodes(offset, (size_t)nodeEnd, node.children);
+
+        offset = (size_t)nodeEnd;
+    }
+}
+
+void FbxFile::ReadProperty(size_t& offset, size_t end, Property& property)
+{
+    CheckSize(offset, 1, end);
+
+    property.type = (char)_data[offset++];
+    property.intValue = 0;
+    property.doubleValue = 0;
+    property.data = nullptr;
+    property.size = 0;
+    property.count = 0;
+
+    const uint8_t* p = &_data[0] + offset;
+
+    switch(property.type)
+    {
+    case 'C':
+        CheckSize(offset, 1, end);
+        property.intValue = (int8_t)*p;
+        property.doubleValue = (double)property.intValue;
+        offset += 1;
+        return;
+
+    case 'Y':
+        CheckSize(offset, 2, end);
+        property.intValue = ReadValue<int16_t>(p);
+        property.doubleValue = (double)property.intValue;
+        offset += 2;
+        return;
+
+    case 'I':
+        CheckSize(offset, 4, end);
+        property.intValue = ReadValue<int32_t>(p);
+        property.doubleValue = (double)property.intValue;
+        offset += 4;
+        return;
+
+    case 'L':
+        CheckSize(offset, 8, end);
+        property.intValue = ReadValue<int64_t>(p);
+        property.doubleValue = (double)property.intValue;
+        offset += 8;
+        return;
+
+    case 'F':
+        CheckSize(offset, 4, end);
+        property.doubleValue = ReadValue<float>(p);
+        property.intValue = (int64_t)property.doubleValue;
+        offset += 4;
+        return;
+
+    case 'D':
+        CheckSize(offset, 8, end);
+        property.doubleValue = ReadValue<double>(p);
+        property.intValue = (int64_t)property.doubleValue;
+        offset += 8;
+        return;
+
+    case 'S':
+    case 'R':
+        CheckSize(offset, 4, end);
+        property.size = ReadValue<uint32_t>(p);
+        offset += 4;
+        CheckSize(offset, property.size, end);
+        property.data = p + 4;
+        offset += property.size;
+        return;
+    }
+
+    size_t elementSize = GetElementSize(property.type);
+    if(elementSize == 0)
+        throw runtime_error("The FBX file has a property of unknown type '" + string(1, property.type) + "'.");
+
+    CheckSize(offset, 12, end);
+    uint32_t count = ReadValue<uint32_t>(p);
+    uint32_t encoding = ReadValue<uint32_t>(p + 4);
+    uint32_t storedSize = ReadValue<uint32_t>(p + 8);
+    offset += 12;
+
+    CheckSize(offset, storedSize, end);
+
+    property.count = count;
+    property.size = (size_t)count * elementSize;
+
+    if(encoding == 0)
+    {
+        if(storedSize != property.size)
+            throw runtime_error("The FBX file is damaged.");
+
+        property.data = p + 12;
+    }
+    else if(encoding == 1)
+    {
+        // deflated, inflated later along with the others. the offsets keep
+        // the arrays aligned for their elements.
+        size_t arrayOffset = _compressed.empty() ? 0 : _compressed.back().offset + _compressed.back().dstSize;
+        arrayOffset = (arrayOffset + 7) & ~(size_t)7;
+
+        property.intValue = (int64_t)_compressed.size();
+        _compressed.push_back({ p + 12, storedSize, property.size, arrayOffset });
+    }
+    else
+    {
+        throw runtime_error("The FBX file has an array of unknown encoding.");
+    }
+
+    offset += storedSize;
+}
+
+void FbxFile::InflateArrays(JobSystem* jobSystem)
+{
+    if(_compressed.empty())
+        return;
+
+    _inflated.resize(_compressed.back().offset + _compressed.back().dstSize);
+
+    // the few large arrays of a mesh, like its vertices and indices, take most of the time
+    atomic<bool> damaged(false);
+
+    auto inflate = [&](size_t i)
+    {
+        const CompressedArray& array = _compressed[i];
+
+        if(!Zlib::Inflate(array.src, array.srcSize, _inflated.data() + array.offset, array.dstSize))
+            damaged = true;
+    };
+
+    if(jobSystem)
+    {
+        jobSystem->ParallelFor(_compressed.size(), inflate);
+    }
+    else
+    {
+        for(size_t i = 0; i < _compressed.size(); ++i)
+            inflate(i);
+    }
+
+    if(damaged)
+        throw runtime_error("The FBX file has a damaged array.");
+
+    LinkArrays(_root);
+}
+
+void FbxFile::LinkArrays(Node& node)
+{
+    for(auto& property : node.properties)
+    {
+        if(property.isArray() && !property.data)
+        {
+            property.data = _inflated.data() + _compressed[(size_t)property.intValue].offset;
+            property.intValue = 0;
+        }
+    }
+
+    for(auto& child : node.children)
+        LinkArrays(child);
+}
@@ -0,0 +1,87 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace std;
+
+class JobSystem;
+
+// Reads binary FBX files (version 7.x) into the tree of nodes they're made of. Each node
+// has a name, a list of properties and child nodes, and what they mean is up to the caller.
+//
+// The whole file is read into memory, and properties point into it instead of being copied.
+// Compressed arrays are inflated once the tree is read, in parallel if there's a JobSystem to run them on.
+// ASCII FBX files aren't supported.
+class FbxFile
+{
+public:
+    struct Property
+    {
+        // 'Y', 'C', 'I', 'L' for integers, 'F', 'D' for floats, 'S' and 'R' for strings and raw
+        // data, and 'i', 'l', 'f', 'd', 'b' for arrays of int32, int64, float, double and bool
+        char type;
+        int64_t intValue;
+        double doubleValue;
+        const uint8_t* data; // strings, raw data and arrays
+        size_t size;         // in bytes
+        size_t count;        // elements of an array
+
+        bool isArray() const;
+        int64_t AsInt() const;
+        double AsDouble() const;
+        string AsString() const;
+
+        // converts the elements of a numeric array, or a single number
+        void GetArray(vector<double>& values) const;
+        void GetArray(vector<int32_t>& values) const;
+    };
+
+    struct Node
+    {
+        string name;
+        vector<Property> properties;
+        vector<Node> children;
+
+        // the first child called 'name', or null
+        const Node* Find(const string& name) const;
+    };
+
+    // throws runtime_error if the file can't be read or isn't a binary FBX file.
+    // the compressed arrays are inflated on 'jobSystem', if there is one.
+    explicit FbxFile(const string& filename, JobSystem* jobSystem = nullptr);
+
+    FbxFile(const FbxFile&) = delete;
+    FbxFile& operator=(const FbxFile&) = delete;
+
+    uint32_t version() const;
+
+    // the top level nodes are its children
+    const Node& root() const;
+
+private:
+    // an array inflated into _inflated after the nodes are read. until then, the
+    // property's 'data' is null and its 'intValue' is the index of the array.
+    struct CompressedArray
+    {
+        const uint8_t* src;
+        size_t srcSize;
+        size_t dstSize;
+        size_t offset; // in _inflated
+    };
+
+    void ReadNodes(size_t& offset, size_t end, vector<Node>& nodes);
+    void ReadProperty(size_t& offset, size_t end, Property& property);
+    void InflateArrays(JobSystem* jobSystem);
+    void LinkArrays(Node& node);
+
+    vector<uint8_t> _data;
+    vector<uint8_t> _inflated;
+    vector<CompressedArray> _compressed;
+    uint32_t _version;
+    Node _root;
+};
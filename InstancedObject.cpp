@@ -0,0 +1,324 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "InstancedObject.h"
+#include "Camera.h"
+#include "Model.h"
+#include "SIMD.h"
+#include <cfloat>
+#include <cmath>
+
+InstancedObject::InstancedObject(const string& name,
+                                 const shared_ptr<Model>& model,
+                                 const shared_ptr<Texture>& texture,
+                                 const shared_ptr<Shader>& shader,
+                                 CullMode cullMode)
+{
+    this->name = name;
+    this->model = model;
+    this->texture = texture;
+    this->shader = shader;
+    this->cullMode = cullMode;
+
+    _version = 0;
+    _lodVersion = 0;
+    _bounds = Box(Vec3::zero, Vec3::zero);
+    _allChanged = true;
+    _model = nullptr;
+    _modelVersion = 0;
+}
+
+uint32_t InstancedObject::AddInstance(const Vec3& position, const Quat& rotation, const Vec3& scale, const Vec4& parameters)
+{
+    uint32_t index = instanceCount();
+    _positions.push_back(position);
+    _rotations.push_back(rotation);
+    _scales.push_back(scale);
+    _parameters.push_back(parameters);
+    _lods.push_back(0);
+    Changed(index);
+    return index;
+}
+
+void InstancedObject::SetInstance(uint32_t index, const Vec3& position, const Quat& rotation, const Vec3& scale)
+{
+    _positions[index] = position;
+    _rotations[index] = rotation;
+    _scales[index] = scale;
+    Changed(index);
+}
+
+void InstancedObject::SetParameters(uint32_t index, const Vec4& parameters)
+{
+    // nothing derived from them, so only the version changes
+    _parameters[index] = parameters;
+    ++_version;
+}
+
+void InstancedObject::RemoveInstance(uint32_t index)
+{
+    uint32_t last = instanceCount() - 1;
+
+    if(index != last)
+    {
+        _positions[index] = _positions[last];
+        _rotations[index] = _rotations[last];
+        _scales[index] = _scales[last];
+        _parameters[index] = _parameters[last];
+        _lods[index] = _lods[last];
+        Changed(index);
+    }
+
+    _positions.pop_back();
+    _rotations.pop_back();
+    _scales.pop_back();
+    _parameters.pop_back();
+    _lods.pop_back();
+    ++_version;
+}
+
+void InstancedObject::ClearInstances()
+{
+    _positions.clear();
+    _rotations.clear();
+    _scales.clear();
+    _parameters.clear();
+    _lods.clear();
+    _allChanged = true;
+    ++_version;
+}
+
+uint32_t InstancedObject::instanceCount() const {
+    return (uint32_t)_positions.size();
+}
+
+const Vec3& InstancedObject::GetPosition(uint32_t index) const {
+    return _positions[index];
+}
+
+const Quat& InstancedObject::GetRotation(uint32_t index) const {
+    return _rotations[index];
+}
+
+const Vec3& InstancedObject::GetScale(uint32_t index) const {
+    return _scales[index];
+}
+
+const Vec4& InstancedObject::GetParameters(uint32_t index) const {
+    return _parameters[index];
+}
+
+uint32_t InstancedObject::GetVersion() const {
+    return _version;
+}
+
+const Mat4& InstancedObject::GetMatrix(uint32_t index)
+{
+    Update();
+    return _matrices[index];
+}
+
+const Mat4& InstancedObject::GetNormalMatrix(uint32_t index)
+{
+    Update();
+    return _normalMatrices[index];
+}
+
+Sphere InstancedObject::GetWorldBoundingSphere()
+{
+    Update();
+    Vec3 center = (_bounds.vmin + _bounds.vmax) * 0.5f;
+    return Sphere(center, (_bounds.vmax - center).Length());
+}
+
+const Box& InstancedObject::GetWorldBounds()
+{
+    Update();
+    return _bounds;
+}
+
+int InstancedObject::SelectLOD(uint32_t index, const Camera& camera)
+{
+    Update();
+
+    Sphere bounds(Vec3(_centerX[index], _centerY[index], _centerZ[index]), _radius[index]);
+    int lod = model->SelectLOD(camera.GetScreenSize(bounds), _lods[index]);
+
+    if(lod != _lods[index])
+    {
+        _lods[index] = lod;
+        ++_lodVersion;
+    }
+
+    return lod;
+}
+
+uint32_t InstancedObject::GetLODVersion() const {
+    return _lodVersion;
+}
+
+void InstancedObject::Cull(const Plane* planes, int planeCount, vector<uint32_t>& indices)
+{
+    Update();
+
+    uint32_t count = instanceCount();
+    if(count == 0)
+        return;
+
+    // all of the instances at once first
+    Vec3 center = (_bounds.vmin + _bounds.vmax) * 0.5f;
+    Vec3 extent = (_bounds.vmax - _bounds.vmin) * 0.5f;
+
+    for(int p = 0; p < planeCount; ++p)
+    {
+        const Plane& plane = planes[p];
+        float radius = extent.x * fabs(plane.a) + extent.y * fabs(plane.b) + extent.z * fabs(plane.c);
+
+        if(plane.Distance(center) < -radius)
+            return;
+    }
+
+    for(uint32_t i = 0; i < count; i += 4)
+    {
+#if USE_SSE
+        __m128 x = _mm_load_ps(&_centerX[i]);
+        __m128 y = _mm_load_ps(&_centerY[i]);
+        __m128 z = _mm_load_ps(&_centerZ[i]);
+        __m128 r = _mm_load_ps(&_radius[i]);
+        __m128 negR = _mm_sub_ps(_mm_setzero_ps(), r);
+
+        // the padding is empty, so it never shows up
+        __m128 visible = _mm_cmpge_ps(r, _mm_set1_ps(FLT_EPSILON));
+
+        for(int p = 0; p < planeCount; ++p)
+        {
+            const Plane& plane = planes[p];
+            __m128 dist = _mm_mul_ps(x, _mm_set1_ps(plane.a));
+            dist = _mm_add_ps(dist, _mm_mul_ps(y, _mm_set1_ps(plane.b)));
+            dist = _mm_add_ps(dist, _mm_mul_ps(z, _mm_set1_ps(plane.c)));
+            dist = _mm_add_ps(dist, _mm_set1_ps(plane.d));
+            visible = _mm_and_ps(visible, _mm_cmpge_ps(dist, negR));
+        }
+
+        int mask = _mm_movemask_ps(visible);
+
+        for(uint32_t k = i; mask != 0; ++k, mask >>= 1)
+        {
+            if(mask & 1)
+                indices.push_back(k);
+        }
+#else
+        for(uint32_t k = i; k < i + 4 && k < count; ++k)
+        {
+            Sphere sphere(_centerX[k], _centerY[k], _centerZ[k], _radius[k]);
+            if(sphere.radius < FLT_EPSILON)
+                continue;
+
+            bool visible = true;
+
+            for(int p = 0; p < planeCount && visible; ++p)
+                visible = !planes[p].InBack(sphere);
+
+            if(visible)
+                indices.push_back(k);
+        }
+#endif
+    }
+}
+
+void InstancedObject::Changed(uint32_t index)
+{
+    ++_version;
+
+    // past this point it's as quick to update all of them
+    if(!_allChanged)
+    {
+        if(_changed.size() < _positions.size() / 4)
+            _changed.push_back(index);
+        else
+            _allChanged = true;
+    }
+}
+
+void InstancedObject::Update()
+{
+    if(_model != model.get() || _modelVersion != model->GetVersion())
+    {
+        _model = model.get();
+        _modelVersion = model->GetVersion();
+        _allChanged = true;
+    }
+
+    uint32_t count = instanceCount();
+
+    // removing the last instance doesn't change any of the others
+    if(!_allChanged && _changed.empty() && _matrices.size() == count)
+        return;
+
+    uint32_t padded = (count + 3) & ~3u;
+
+    _matrices.resize(count);
+    _normalMatrices.resize(count);
+    _centerX.resize(padded);
+    _centerY.resize(padded);
+    _centerZ.resize(padded);
+    _radius.resize(padded);
+
+    if(_allChanged)
+    {
+        for(uint32_t i = 0; i < count; ++i)
+            UpdateInstance(i);
+    }
+    else
+    {
+        // removed instances may have been changed before they went
+        for(uint32_t index : _changed)
+        {
+            if(index < count)
+                UpdateInstance(index);
+        }
+    }
+
+    for(uint32_t i = count; i < padded; ++i)
+    {
+        _centerX[i] = 0;
+        _centerY[i] = 0;
+        _centerZ[i] = 0;
+        _radius[i] = 0;
+    }
+
+    _bounds = Box(Vec3::zero, Vec3::zero);
+
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        Vec3 c(_centerX[i], _centerY[i], _centerZ[i]);
+        Vec3 r(_radius[i], _radius[i], _radius[i]);
+        Box box(c - r, c + r);
+
+        if(i == 0)
+            _bounds = box;
+        else
+            _bounds += box;
+    }
+
+    _changed.clear();
+    _allChanged = false;
+}
+
+void InstancedObject::UpdateInstance(uint32_t index)
+{
+    const Vec3& position = _positions[index];
+    const Quat& rotation = _rotations[index];
+    const Vec3& scale = _scales[index];
+
+    _matrices[index] = Mat4::Transform(position, scale, rotation);
+    _normalMatrices[index] = Mat4::InverseTransform(position, scale, rotation).Transposed();
+
+    Vec4 center = Vec4(model->bsphere.center, 1) * _matrices[index];
+    _centerX[index] = center.x;
+    _centerY[index] = center.y;
+    _centerZ[index] = center.z;
+    _radius[index] = Math::Max(scale.x, scale.y, scale.z) * model->bsphere.radius;
+}
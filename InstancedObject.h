@@ -0,0 +1,110 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Math.h"
+#include "Mem.h"
+#include "SceneObject.h"
+using namespace std;
+
+class Camera;
+
+// what a shader needs to draw one instance of an InstancedObject
+struct alignas(16) InstanceData
+{
+    Mat4 mtxModel;
+    Mat4 mtxMVP;
+    Mat4 mtxNormal;
+    Vec4 parameters;
+};
+
+// Many copies of a model drawn with the same texture and shader, for things like
+// vegetation. The instances are kept as arrays of positions, rotations, scales and
+// shader parameters instead of objects of their own. They're culled four at a time,
+// and the shader is prepared once for all of them, so each one only costs its matrices.
+class alignas(16) InstancedObject
+{
+public:
+    string name;
+    shared_ptr<Model> model;
+    shared_ptr<Texture> texture;
+    shared_ptr<Shader> shader;
+    CullMode cullMode;
+    bool castShadows = true;
+
+    // one per frame a rendering context can have in flight, shared by all of the instances
+    static constexpr int DrawStateCount = SceneObject::DrawStateCount;
+    DrawState drawStates[DrawStateCount];
+
+    InstancedObject(const string& name,
+                    const shared_ptr<Model>& model,
+                    const shared_ptr<Texture>& texture,
+                    const shared_ptr<Shader>& shader,
+                    CullMode cullMode = CullMode::Back);
+
+    // 'parameters' are passed on to the shader as they are
+    uint32_t AddInstance(const Vec3& position, const Quat& rotation, const Vec3& scale, const Vec4& parameters = Vec4::zero);
+    void SetInstance(uint32_t index, const Vec3& position, const Quat& rotation, const Vec3& scale);
+    void SetParameters(uint32_t index, const Vec4& parameters);
+
+    // the last instance takes the place of the removed one
+    void RemoveInstance(uint32_t index);
+    void ClearInstances();
+
+    uint32_t instanceCount() const;
+    const Vec3& GetPosition(uint32_t index) const;
+    const Quat& GetRotation(uint32_t index) const;
+    const Vec3& GetScale(uint32_t index) const;
+    const Vec4& GetParameters(uint32_t index) const;
+
+    // incremented every time an instance is added, removed or changed
+    uint32_t GetVersion() const;
+
+    // world space, brought up to date with the instances and the model when asked for
+    const Mat4& GetMatrix(uint32_t index);
+    const Mat4& GetNormalMatrix(uint32_t index);
+    Sphere GetWorldBoundingSphere();
+    const Box& GetWorldBounds();
+
+    // appends the indices of the instances whose bounding sphere isn't entirely behind any of 'planes'
+    void Cull(const Plane* planes, int planeCount, vector<uint32_t>& indices);
+
+    // picks the model LOD an instance is drawn with from its size on screen, see Model::SelectLOD
+    int SelectLOD(uint32_t index, const Camera& camera);
+
+    // incremented every time the LOD of an instance changes
+    uint32_t GetLODVersion() const;
+
+private:
+    void Changed(uint32_t index);
+    void Update();
+    void UpdateInstance(uint32_t index);
+
+    vector<Vec3, AlignedAllocator<Vec3, 16>> _positions;
+    vector<Quat, AlignedAllocator<Quat, 16>> _rotations;
+    vector<Vec3, AlignedAllocator<Vec3, 16>> _scales;
+    vector<Vec4, AlignedAllocator<Vec4, 16>> _parameters;
+    vector<int> _lods; // picked on the last frame each instance was drawn
+    uint32_t _version;
+    uint32_t _lodVersion;
+
+    // derived from the above by Update(). the bounding spheres are split by component
+    // and padded with empty ones to a multiple of four, so they can be culled four at a time.
+    vector<Mat4, AlignedAllocator<Mat4, 16>> _matrices;
+    vector<Mat4, AlignedAllocator<Mat4, 16>> _normalMatrices;
+    vector<float, AlignedAllocator<float, 16>> _centerX;
+    vector<float, AlignedAllocator<float, 16>> _centerY;
+    vector<float, AlignedAllocator<float, 16>> _centerZ;
+    vector<float, AlignedAllocator<float, 16>> _radius;
+    Box _bounds;
+    vector<uint32_t> _changed; // instances changed since the last update
+    bool _allChanged;
+    const Model* _model;
+    uint32_t _modelVersion;
+};
@@ -0,0 +1,560 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "JobSystem.h"
+#include "Mem.h"
+#include <algorithm>
+#include <stdexcept>
+
+// the job system and queue owned by the current thread, if it's a worker
+static thread_local JobSystem* currentSystem = nullptr;
+static thread_local size_t currentQueue = 0;
+
+// group of the job the current thread is running
+static thread_local JobGroup* currentGroup = nullptr;
+
+////////////////////////////////
+//    JobPool
+////////////////////////////////
+
+// blocks of memory for jobs and their reference counts, kept for reuse once a job is released.
+// the blocks come in slabs that double the pool each time it runs out, since how many jobs are
+// alive at once depends on timing, and growing one block at a time would keep finding a new peak.
+class JobPool
+{
+    static constexpr size_t MinSlabBlocks = 64;
+
+    mutex _lock;
+    size_t _blockSize = 0;
+    atomic<size_t> _blockCount{0};
+    vector<void*> _slabs;
+    vector<void*> _free;
+
+public:
+    ~JobPool()
+    {
+        for(auto slab : _slabs)
+            AlignedFree(slab);
+    }
+
+    void* Allocate(size_t size)
+    {
+        lock_guard<mutex> lk(_lock);
+
+        if(_blockSize == 0)
+            _blockSize = (size + 15) & ~(size_t)15;
+
+        if(size > _blockSize)
+            return AlignedAlloc(size, 16);
+
+        if(_free.empty())
+        {
+            size_t slabBlocks = max(_blockCount.load(), MinSlabBlocks);
+            uint8_t* slab = (uint8_t*)AlignedAlloc(slabBlocks * _blockSize, 16);
+            _slabs.push_back(slab);
+            _blockCount += slabBlocks;
+
+            // room for every block to come back without reallocating
+            _free.reserve(_blockCount);
+
+            for(size_t i = 0; i < slabBlocks; ++i)
+                _free.push_back(slab + i * _blockSize);
+        }
+
+        void* block = _free.back();
+        _free.pop_back();
+        return block;
+    }
+
+    // how many jobs can be alive at once before the pool has to grow
+    size_t blockCount() const {
+        return _blockCount;
+    }
+
+    void Free(void* block, size_t size)
+    {
+        lock_guard<mutex> lk(_lock);
+
+        if(size <= _blockSize)
+            _free.push_back(block);
+        else
+            AlignedFree(block);
+    }
+};
+
+// keeps the pool alive for as long as any job allocated from it
+template<class T>
+struct JobAllocator
+{
+    typedef T value_type;
+
+    shared_ptr<JobPool> pool;
+
+    JobAllocator(const shared_ptr<JobPool>& pool) : pool(pool){}
+
+    template<class U>
+    JobAllocator(const JobAllocator<U>& other) : pool(other.pool){}
+
+    T* allocate(size_t n) {
+        return (T*)pool->Allocate(n * sizeof(T));
+    }
+
+    void deallocate(T* p, size_t n) {
+        pool->Free(p, n * sizeof(T));
+    }
+
+    template<class U>
+    bool operator==(const JobAllocator<U>& other) const {
+        return pool == other.pool;
+    }
+
+    template<class U>
+    bool operator!=(const JobAllocator<U>& other) const {
+        return pool != other.pool;
+    }
+};
+
+////////////////////////////////
+//    JobGroup
+////////////////////////////////
+
+JobGroup::JobGroup(JobSystem* system, size_t queueCount, int priority)
+    : _system(system), _queuedJobs(0), _pass(0), _priority(max(priority, 1)), _inUse(true)
+{
+    for(size_t i = 0; i < queueCount; ++i)
+        _queues.push_back(make_unique<WorkQueue>());
+}
+
+void JobGroup::WorkQueue::PushBack(JobHandle&& job, size_t jobCapacity)
+{
+    // a queue can't hold more jobs than are alive, so once it has room for as many as the
+    // pool, it only grows with the pool, whichever worker the jobs end up with
+    if(count == jobs.size() || jobs.size() < jobCapacity)
+    {
+        size_t size = count == jobs.size() ? jobs.size() * 2 : jobs.size();
+        vector<JobHandle> grown(max({ size, jobCapacity, (size_t)16 }));
+
+        for(size_t i = 0; i < count; ++i)
+            grown[i] = move(jobs[(first + i) % jobs.size()]);
+
+        jobs.swap(grown);
+        first = 0;
+    }
+
+    jobs[(first + count++) % jobs.size()] = move(job);
+}
+
+JobHandle JobGroup::WorkQueue::PopBack()
+{
+    if(count == 0)
+        return nullptr;
+
+    return move(jobs[(first + --count) % jobs.size()]);
+}
+
+JobHandle JobGroup::WorkQueue::PopFront()
+{
+    if(count == 0)
+        return nullptr;
+
+    JobHandle job = move(jobs[first]);
+    first = (first + 1) % jobs.size();
+    --count;
+
+    return job;
+}
+
+void JobGroup::priority(int priority) {
+    _priority = max(priority, 1);
+}
+
+int JobGroup::priority() const {
+    return _priority;
+}
+
+////////////////////////////////
+//    JobSystem
+////////////////////////////////
+
+JobSystem::JobSystem(size_t threadCount)
+    : _jobPool(make_shared<JobPool>()), _groupCount(0), _virtualTime(0), _nextQueue(0), _queuedJobs(0),
+      _sleepingWorkers(0), _waitingThreads(0), _run(true)
+{
+    size_t workerCount = threadCount > 1 ? threadCount - 1 : 0;
+    _queueCount = max(workerCount, (size_t)1);
+    _defaultGroup = CreateGroup();
+
+    for(size_t i = 0; i < workerCount; ++i)
+        _threads.emplace_back(&JobSystem::Run, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        lock_guard<mutex> lk(_parkLock);
+        _run = false;
+    }
+
+    _workCV.notify_all();
+
+    for(auto& t : _threads)
+        t.join();
+}
+
+shared_ptr<JobSystem> JobSystem::shared()
+{
+    static mutex lock;
+    static weak_ptr<JobSystem> instance;
+
+    lock_guard<mutex> lk(lock);
+
+    shared_ptr<JobSystem> system = instance.lock();
+    if(!system)
+    {
+        system = make_shared<JobSystem>(max(thread::hardware_concurrency(), 1u));
+        instance = system;
+    }
+
+    return system;
+}
+
+size_t JobSystem::threadCount() const {
+    return _threads.size() + 1;
+}
+
+JobGroup* JobSystem::CreateGroup(int priority)
+{
+    lock_guard<mutex> lk(_groupLock);
+
+    // workers may be looking at released groups, so they're reused rather than deleted
+    int count = _groupCount;
+    for(int i = 0; i < count; ++i)
+    {
+        JobGroup* group = _groups[i].get();
+        if(!group->_inUse)
+        {
+            group->priority(priority);
+            group->_pass = _virtualTime.load();
+            group->_inUse = true;
+            return group;
+        }
+    }
+
+    if(count == MaxGroups)
+        throw runtime_error("Too many job groups.");
+
+    _groups[count] = make_unique<JobGroup>(this, _queueCount, priority);
+    _groups[count]->_pass = _virtualTime.load();
+    _groupCount = count + 1;
+
+    return _groups[count].get();
+}
+
+void JobSystem::ReleaseGroup(JobGroup* group)
+{
+    lock_guard<mutex> lk(_groupLock);
+    group->_inUse = false;
+}
+
+JobHandle JobSystem::Schedule(function<void()> function, JobGroup* group) {
+    return Schedule(move(function), (const JobHandle*)nullptr, (const JobHandle*)nullptr, group);
+}
+
+JobHandle JobSystem::Schedule(function<void()> function, initializer_list<JobHandle> dependencies, JobGroup* group) {
+    return Schedule(move(function), dependencies.begin(), dependencies.end(), group);
+}
+
+JobHandle JobSystem::Schedule(function<void()> function, const vector<JobHandle>& dependencies, JobGroup* group) {
+    return Schedule(move(function), dependencies.begin(), dependencies.end(), group);
+}
+
+JobGroup* JobSystem::SelectGroup(JobGroup* group) const
+{
+    if(group)
+        return group;
+
+    bool inherit = currentGroup && currentGroup->_system == this;
+    return inherit ? currentGroup : _defaultGroup;
+}
+
+template<class Iter>
+JobHandle JobSystem::Schedule(function<void()>&& function, Iter first, Iter last, JobGroup* group)
+{
+    auto job = allocate_shared<Job>(JobAllocator<Job>(_jobPool));
+    job->_function = move(function);
+    job->_group = SelectGroup(group);
+    // the initial count of 1 keeps the job from being pushed by a
+    // dependency that finishes before they have all been registered
+    for( ; first != last; ++first)
+    {
+        const JobHandle& dep = *first;
+        if(!dep)
+            continue;
+
+        lock_guard<mutex> lk(dep->_lock);
+
+        if(!dep->_done)
+        {
+            job->_pending.fetch_add(1);
+            dep->_continuations.push_back(job);
+        }
+    }
+
+    if(job->_pending.fetch_sub(1) == 1)
+        Push(job);
+
+    return job;
+}
+
+template<class Pred>
+void JobSystem::WaitUntil(Pred done, JobGroup* preferred)
+{
+    while(!done())
+    {
+        JobHandle other = Pop(preferred);
+        if(other)
+        {
+            Execute(other);
+            continue;
+        }
+
+        // jobs notify waiting threads after they've finished, and
+        // waiting threads register under _parkLock before checking
+        unique_lock<mutex> lk(_parkLock);
+        _waitingThreads.fetch_add(1);
+        _doneCV.wait(lk, [&]{ return done() || _queuedJobs > 0; });
+        _waitingThreads.fetch_sub(1);
+    }
+}
+
+void JobSystem::Wait(const JobHandle& job)
+{
+    // the waited on job's group first, since that's what this thread needs done
+    WaitUntil([&]{ return job->_done.load(); }, job->_group);
+
+    if(job->_exception)
+        rethrow_exception(job->_exception);
+}
+
+void JobSystem::Wait(const vector<JobHandle>& jobs)
+{
+    for(auto& job : jobs)
+        Wait(job);
+}
+
+void JobSystem::ParallelFor(size_t count, const function<void(size_t)>& function, JobGroup* group)
+{
+    if(count == 0)
+        return;
+
+    // shared with the jobs, which all finish before this returns. the jobs are
+    // counted down instead of kept, so that the loop doesn't allocate anything.
+    struct Loop
+    {
+        const std::function<void(size_t)>& function;
+        atomic<size_t> remaining;
+        mutex lock;
+        exception_ptr error;
+
+        Loop(const std::function<void(size_t)>& function, size_t count)
+            : function(function), remaining(count){}
+
+        void Run(size_t i)
+        {
+            try {
+                function(i);
+            }
+            catch(...) {
+                lock_guard<mutex> lk(lock);
+                if(!error)
+                    error = current_exception();
+            }
+        }
+    } loop(function, count - 1);
+
+    group = SelectGroup(group);
+
+    for(size_t i = 0; i + 1 < count; ++i)
+    {
+        Schedule([&loop, i]{
+            loop.Run(i);
+            loop.remaining.fetch_sub(1);
+        }, group);
+    }
+
+    // the last index runs here, after everything else has been handed out
+    loop.Run(count - 1);
+
+    WaitUntil([&]{ return loop.remaining == 0; }, group);
+
+    if(loop.error)
+        rethrow_exception(loop.error);
+}
+
+void JobSystem::Push(JobHandle job)
+{
+    JobGroup& group = *job->_group;
+
+    size_t index = currentSystem == this ?
+        currentQueue : _nextQueue.fetch_add(1) % _queueCount;
+
+    JobGroup::WorkQueue& queue = *group._queues[index];
+    {
+        lock_guard<mutex> lk(queue.lock);
+        queue.PushBack(move(job), _jobPool->blockCount());
+    }
+
+    // a group that was idle doesn't get to make up for the time it had nothing to do
+    if(group._queuedJobs.fetch_add(1) == 0)
+    {
+        uint64_t now = _virtualTime;
+        if(group._pass < now)
+            group._pass = now;
+    }
+
+    // sleepers register under _parkLock before re-checking _queuedJobs,
+    // so either they see this job or they are seen here and woken up
+    _queuedJobs.fetch_add(1);
+
+    if(_sleepingWorkers > 0 || _waitingThreads > 0)
+    {
+        lock_guard<mutex> lk(_parkLock);
+        _workCV.notify_one();
+        _doneCV.notify_one();
+    }
+}
+
+JobHandle JobSystem::Pop(JobGroup* preferred)
+{
+    if(preferred)
+    {
+        JobHandle job = PopFrom(*preferred);
+        if(job)
+            return job;
+    }
+
+    int groupCount = _groupCount;
+
+    // the group with work that has had the smallest share of the workers so far.
+    // another thread may empty it first, in which case the next one is tried.
+    for(int attempt = 0; attempt < groupCount; ++attempt)
+    {
+        JobGroup* next = nullptr;
+
+        for(int i = 0; i < groupCount; ++i)
+        {
+            JobGroup* group = _groups[i].get();
+            if(group->_queuedJobs > 0 && (!next || group->_pass < next->_pass))
+                next = group;
+        }
+
+        if(!next)
+            break;
+
+        JobHandle job = PopFrom(*next);
+        if(job)
+            return job;
+    }
+
+    return nullptr;
+}
+
+JobHandle JobSystem::PopFrom(JobGroup& group)
+{
+    if(group._queuedJobs <= 0)
+        return nullptr;
+
+    size_t own = currentSystem == this ? currentQueue : 0;
+    JobHandle job;
+
+    // newest job from our own queue, which is likely still in cache
+    if(currentSystem == this)
+    {
+        JobGroup::WorkQueue& queue = *group._queues[own];
+        lock_guard<mutex> lk(queue.lock);
+        job = queue.PopBack();
+    }
+
+    // otherwise steal the oldest job from someone else
+    for(size_t i = 0; i < _queueCount && !job; ++i)
+    {
+        JobGroup::WorkQueue& queue = *group._queues[(own + i) % _queueCount];
+        lock_guard<mutex> lk(queue.lock);
+        job = queue.PopFront();
+    }
+
+    if(job)
+    {
+        group._queuedJobs.fetch_sub(1);
+        _queuedJobs.fetch_sub(1);
+
+        uint64_t pass = group._pass.fetch_add(Stride / group._priority);
+        if(pass > _virtualTime)
+            _virtualTime = pass;
+    }
+
+    return job;
+}
+
+void JobSystem::Execute(const JobHandle& job)
+{
+    // jobs scheduled by this one go to the same group
+    JobGroup* outerGroup = currentGroup;
+    currentGroup = job->_group;
+
+    try {
+        job->_function();
+    }
+    catch(...) {
+        job->_exception = current_exception();
+    }
+
+    currentGroup = outerGroup;
+
+    job->_function = nullptr;
+
+    vector<JobHandle> continuations;
+    {
+        lock_guard<mutex> lk(job->_lock);
+        job->_done = true;
+        swap(continuations, job->_continuations);
+    }
+
+    for(auto& next : continuations)
+    {
+        if(next->_pending.fetch_sub(1) == 1)
+            Push(move(next));
+    }
+
+    if(_waitingThreads > 0)
+    {
+        lock_guard<mutex> lk(_parkLock);
+        _doneCV.notify_all();
+    }
+}
+
+void JobSystem::Run(size_t queueIndex)
+{
+    currentSystem = this;
+    currentQueue = queueIndex;
+
+    while(true)
+    {
+        JobHandle job = Pop();
+        if(job)
+        {
+            Execute(job);
+            continue;
+        }
+
+        unique_lock<mutex> lk(_parkLock);
+        if(!_run)
+            break;
+
+        _sleepingWorkers.fetch_add(1);
+        _workCV.wait(lk, [this]{ return _queuedJobs > 0 || !_run; });
+        _sleepingWorkers.fetch_sub(1);
+    }
+}
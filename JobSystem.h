@@ -0,0 +1,160 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+class JobSystem;
+class JobGroup;
+class JobPool;
+
+// a unit of work that runs once all of the jobs it depends on have finished
+class Job
+{
+    friend class JobSystem;
+
+    function<void()> _function;
+    JobGroup* _group;
+    atomic<int> _pending;
+    atomic<bool> _done;
+    exception_ptr _exception;
+    mutex _lock;
+    vector<shared_ptr<Job>> _continuations;
+
+public:
+    Job() : _group(nullptr), _pending(1), _done(false){}
+
+    bool IsDone() const {
+        return _done.load();
+    }
+};
+
+typedef shared_ptr<Job> JobHandle;
+
+// Jobs of one client of a shared job system. While several groups have work queued,
+// the workers split their time between them in proportion to their priorities.
+class JobGroup
+{
+    friend class JobSystem;
+
+    // ring buffer of jobs that only grows, so pushing and popping doesn't allocate
+    struct WorkQueue
+    {
+        mutex lock;
+        vector<JobHandle> jobs;
+        size_t first = 0;
+        size_t count = 0;
+
+        void PushBack(JobHandle&& job, size_t jobCapacity);
+        JobHandle PopBack();
+        JobHandle PopFront();
+    };
+
+    JobSystem* _system;
+    vector<unique_ptr<WorkQueue>> _queues; // one per worker
+    atomic<int> _queuedJobs;
+    atomic<uint64_t> _pass;
+    atomic<int> _priority;
+    atomic<bool> _inUse;
+
+public:
+    JobGroup(JobSystem* system, size_t queueCount, int priority);
+
+    // relative share of the workers, at least 1
+    void priority(int priority);
+    int priority() const;
+};
+
+// Work stealing scheduler. Each worker pushes and pops jobs at the back of its
+// own deque and steals from the front of the others' when it runs dry. Idle
+// workers sleep on a condition variable instead of spinning, and threads
+// waiting on a job run other jobs until it finishes.
+//
+// Jobs belong to a group, each with a deque per worker. Workers take their next
+// job from the group that has received the least of its share so far (stride
+// scheduling), so clients sharing the system interleave job by job.
+class JobSystem
+{
+public:
+    static constexpr int MaxGroups = 64;
+
+    // 'threadCount' includes the thread that waits on jobs,
+    // so threadCount - 1 workers are started
+    JobSystem(size_t threadCount);
+    ~JobSystem();
+
+    // process wide system with a thread per core, alive as long as someone holds on to it
+    static shared_ptr<JobSystem> shared();
+
+    size_t threadCount() const;
+
+    // groups are kept until the system is destroyed, and reused once released.
+    // a group must not have any jobs left when it's released.
+    JobGroup* CreateGroup(int priority = 1);
+    void ReleaseGroup(JobGroup* group);
+
+    // schedules 'function' to run once every job in 'dependencies' has finished.
+    // without a group, jobs scheduled from inside a job go to that job's group,
+    // and others to the default group.
+    JobHandle Schedule(function<void()> function, JobGroup* group = nullptr);
+    JobHandle Schedule(function<void()> function, initializer_list<JobHandle> dependencies, JobGroup* group = nullptr);
+    JobHandle Schedule(function<void()> function, const vector<JobHandle>& dependencies, JobGroup* group = nullptr);
+
+    // blocks until the job has finished, running other jobs in the meantime.
+    // rethrows anything the job threw.
+    void Wait(const JobHandle& job);
+    void Wait(const vector<JobHandle>& jobs);
+
+    // calls 'function(i)' for every i in [0, count) from as many threads as possible and waits for all of them
+    void ParallelFor(size_t count, const function<void(size_t)>& function, JobGroup* group = nullptr);
+
+private:
+    // pass added to a group per job taken, divided by its priority
+    static constexpr uint64_t Stride = 1 << 16;
+
+    template<class Iter>
+    JobHandle Schedule(function<void()>&& function, Iter first, Iter last, JobGroup* group);
+
+    // the group a job scheduled with 'group' goes to
+    JobGroup* SelectGroup(JobGroup* group) const;
+
+    // runs jobs, preferably from 'preferred', until 'done' returns true
+    template<class Pred>
+    void WaitUntil(Pred done, JobGroup* preferred);
+
+    void Push(JobHandle job);
+    JobHandle Pop(JobGroup* preferred = nullptr);
+    JobHandle PopFrom(JobGroup& group);
+    void Execute(const JobHandle& job);
+    void Run(size_t queueIndex);
+
+    shared_ptr<JobPool> _jobPool; // recycles the memory of finished jobs
+    size_t _queueCount;
+    unique_ptr<JobGroup> _groups[MaxGroups];
+    atomic<int> _groupCount;
+    mutex _groupLock;
+    JobGroup* _defaultGroup;
+    atomic<uint64_t> _virtualTime;
+
+    vector<thread> _threads;
+    atomic<uint32_t> _nextQueue;
+    atomic<int> _queuedJobs;
+    atomic<int> _sleepingWorkers;
+    atomic<int> _waitingThreads;
+    atomic<bool> _run;
+    mutex _parkLock;
+    condition_variable _workCV;
+    condition_variable _doneCV;
+};
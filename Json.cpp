@@ -4,6 +4,7 @@
 *--------------------------------------------------------------------------------------------*/
 
 #include "Json.h"
+#include <cmath>
 #include <sstream>
 #include <fstream>
 using namespace std;
@@ -32,7 +33,8 @@ string JSONValue::TypeToString(JSONType type)
 
 JSONValue JSONParser::Parse(const string& json) {
     if(json.empty()) return JSONValue();
-    return ParseValue(Iterator(json.data()));
+    Iterator iter(json.data());
+    return ParseValue(iter);
 }
 
 JSONValue JSONParser::Load(const string& filename) {
@@ -469,9 +471,9 @@ const char& JSONParser::Iterator::operator[](size_t index) const {
 string JSONParser::Iterator::location() const {
     char buff[128];
 #ifdef _MSC_VER
-    sprintf_s(buff, "(%u:%u)", line + 1, column + 1);
+    sprintf_s(buff, "(%u:%u)", static_cast<unsigned>(line + 1), static_cast<unsigned>(column + 1));
 #else
-    sprintf(buff, "(%u:%u)", line + 1, column + 1);
+    sprintf(buff, "(%u:%u)", static_cast<unsigned>(line + 1), static_cast<unsigned>(column + 1));
 #endif
     return buff;
 }
@@ -569,6 +571,6 @@ JSONException::JSONException(const JSONParser::Iterator& iter, const std::string
     msg = move(stream.str());
 }
 
-char const* JSONException::what() const {
+char const* JSONException::what() const noexcept {
     return msg.c_str();
 }
@@ -5,7 +5,10 @@
 
 #pragma once
 #include <string>
+#include <cfloat>
+#include <cstdio>
 #include <cstdlib>
+#include <exception>
 #include <unordered_map>
 #include <vector>
 #include <utility>
@@ -82,29 +85,23 @@ class JSONValue
             return JSONGetType<T>();
         }
 
-        virtual void* GetAddress(JSONType expectedType)
-        {
-            if(JSONGetType<T>() != expectedType)
-                throw JSONException("The contained object is not of type '"s + TypeToString(expectedType) + "'");
+        // defined below JSONException, which it throws
+        virtual void* GetAddress(JSONType expectedType);
 
-            return (void*)&obj;
-        }
-
-        template<class T> std::string _toString() const;
-        template<> std::string _toString<JSONNull>() const { return "null"; }
-        template<> std::string _toString<JSONObject>() const { return "Object"; }
-        template<> std::string _toString<JSONArray>() const { return "Array"; }
-        template<> std::string _toString<JSONString>() const { return obj; }
-        template<> std::string _toString<JSONInteger>() const { return to_string(obj); }
-        template<> std::string _toString<JSONFloat>() const {
+        static std::string _toString(JSONNull) { return "null"; }
+        static std::string _toString(const JSONObject&) { return "Object"; }
+        static std::string _toString(const JSONArray&) { return "Array"; }
+        static std::string _toString(const JSONString& x) { return x; }
+        static std::string _toString(JSONInteger x) { return std::to_string(x); }
+        static std::string _toString(JSONFloat x) {
             char buff[3 + DBL_MANT_DIG - DBL_MIN_EXP];
-            sprintf_s(buff, "%g", obj);
+            snprintf(buff, sizeof(buff), "%g", x);
             return buff;
         }
-        template<> std::string _toString<JSONBoolean>() const { return obj ? "true" : "false"; }
+        static std::string _toString(JSONBoolean x) { return x ? "true" : "false"; }
 
         virtual std::string ToString() const {
-            return _toString<T>();
+            return _toString(obj);
         }
     };
 
@@ -148,7 +145,7 @@ public:
         _construct<JSONNull>(nullptr);
     }
 
-    JSONValue::JSONValue(JSONValue&& x) {
+    JSONValue(JSONValue&& x) {
         _moveFrom(std::move(x));
     }
 
@@ -156,7 +153,7 @@ public:
         _copyFrom(x);
     }
 
-    JSONValue(nullptr_t) {
+    JSONValue(std::nullptr_t) {
         _construct<JSONNull>(nullptr);
     }
 
@@ -397,5 +394,14 @@ class JSONException : public std::exception
 public:
     JSONException(const std::string& message);
     JSONException(const JSONParser::Iterator& iter, const std::string& message);
-    virtual char const* what() const override;
+    virtual char const* what() const noexcept override;
 };
+
+template<class T>
+void* JSONValue::Payload<T>::GetAddress(JSONType expectedType)
+{
+    if(JSONGetType<T>() != expectedType)
+        throw JSONException("The contained object is not of type '"s + TypeToString(expectedType) + "'");
+
+    return (void*)&obj;
+}
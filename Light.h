@@ -5,7 +5,10 @@
 
 #pragma once
 #include "Math.h"
+#include "ShadowMap.h"
 #include <cstdlib>
+#include <string>
+using namespace std;
 
 enum class LightType
 {
@@ -19,10 +22,15 @@ class alignas(16) Light
 {
 public:
     string name;
+
+    // static lights are baked into lightmaps and skipped when shading lightmapped objects
+    bool isStatic = false;
+
     Light(const string& name) : name(name){}
 
     virtual LightType type() const = 0;
     virtual bool CanAffect(const Sphere& bounds) const = 0;
+    virtual Sphere GetBoundingSphere() const = 0;
     virtual Color Apply(const Vec3& surfPos, const Vec3& surfNorm, const Vec3& eyePos, const Vec3& eyeDir) const = 0;
     virtual void Update() = 0;
 };
@@ -49,6 +57,10 @@ public:
         return true;
     }
 
+    virtual Sphere GetBoundingSphere() const override {
+        return Sphere(Vec3::zero, FLT_MAX);
+    }
+
     virtual Color Apply(const Vec3& surfPos, const Vec3& surfNorm, const Vec3& eyePos, const Vec3& eyeDir) const override
     {
         return color * intensity;
@@ -63,6 +75,8 @@ public:
     Color color = Color::white;
     float intensity = 1.0f;
     Vec3 direction = Vec3::forward;
+    bool castShadows = false;
+    CascadedShadowMap shadowMap;
 
     DirectionalLight(const string& name) : Light(name){}
     DirectionalLight(const string& name,
@@ -82,12 +96,19 @@ public:
         return true;
     }
 
+    virtual Sphere GetBoundingSphere() const override {
+        return Sphere(Vec3::zero, FLT_MAX);
+    }
+
     virtual Color Apply(const Vec3& surfPos, const Vec3& surfNorm, const Vec3& eyePos, const Vec3& eyeDir) const override
     {
         float cn = surfNorm.Dot(-direction);
         if(cn < 0)
             return Color::clear;
 
+        if(castShadows)
+            cn *= shadowMap.Sample(surfPos, surfNorm);
+
         return color * cn * intensity;
     }
 
@@ -127,6 +148,10 @@ public:
         return distSq < r * r;
     }
 
+    virtual Sphere GetBoundingSphere() const override {
+        return Sphere(position, distAttenMax);
+    }
+
     virtual Color Apply(const Vec3& surfPos, const Vec3& surfNorm, const Vec3& eyePos, const Vec3& eyeDir) const override
     {
         Vec3 lightVec = surfPos - position;
@@ -164,6 +189,9 @@ public:
     float angAttenMax = 45.0f;
     float distAttenMin = 8.0f;
     float distAttenMax = 10.0f;
+    bool castShadows = false;
+    uint32_t shadowMapSize = 512;
+    ShadowMap shadowMap;
 
     SpotLight(const string& name) : Light(name){}
     SpotLight(const string& name,
@@ -200,6 +228,19 @@ public:
         return true;
     }
 
+    virtual Sphere GetBoundingSphere() const override
+    {
+        // smallest sphere enclosing the cone of influence
+        float hAng = Math::DegToRad * angAttenMax * 0.5f;
+        float cosAng = cos(hAng);
+
+        if(hAng > Math::Pi * 0.25f)
+            return Sphere(position + direction * (distAttenMax * cosAng), distAttenMax * sin(hAng));
+
+        float radius = distAttenMax / (2.0f * cosAng);
+        return Sphere(position + direction * radius, radius);
+    }
+
     virtual Color Apply(const Vec3& surfPos, const Vec3& surfNorm, const Vec3& eyePos, const Vec3& eyeDir) const override
     {
         Vec3 lightVec = surfPos - position;
@@ -229,6 +270,9 @@ public:
         float cd = Math::NormalizedClamp(dist, distAttenMin, distAttenMax);
         cd = (1.0f - cd * cd);
 
+        if(castShadows)
+            cn *= shadowMap.Sample(surfPos, surfNorm);
+
         return color * ca * cd * cn * intensity;
     }
 
@@ -250,4 +294,20 @@ public:
         _frustum[4] = Plane(tn, position);
         _frustum[5] = Plane(bn, position);
     }
+
+    // fits the shadow map's perspective projection to the cone of influence
+    void UpdateShadowMap()
+    {
+        shadowMap.Resize(shadowMapSize);
+
+        float fov = Math::Min(angAttenMax, 170.0f);
+        float nearPlane = distAttenMax * 0.01f;
+        Vec3 up = abs(direction.y) > 0.99f ? Vec3::forward : Vec3::up;
+
+        Mat4 mtxView = Mat4::InverseTransform(position, Vec3(1, 1, 1), Quat::LookRotation(direction, up));
+        Mat4 mtxProj = Mat4::Project3D(fov, 1.0f, nearPlane, distAttenMax);
+        float extent = 2.0f * tan(Math::DegToRad * fov * 0.5f);
+
+        shadowMap.SetViewProjection(mtxView * mtxProj, Vec4(position, 1.0f), extent);
+    }
 };
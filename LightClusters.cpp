@@ -0,0 +1,656 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "LightClusters.h"
+#include "Camera.h"
+#include "Light.h"
+#include <cmath>
+#include <algorithm>
+
+LightClusters::LightClusters()
+{
+    _fov = 0;
+    _aspect = 0;
+    _nearPlane = 0;
+    _farPlane = 0;
+    _mtxView = Mat4::identity;
+    _mtxCamera = Mat4::identity;
+    _scaleX = 1.0f;
+    _scaleY = 1.0f;
+    _sliceScale = 0;
+    _sliceBias = 0;
+
+    _bounds.resize(ClusterCount);
+    _clusterOffsets.resize(ClusterCount + 1, 0);
+    _clusterCounts.resize(ClusterCount, 0);
+    _clusterBlocks.resize(ClusterCount, ClusterBlocks{});
+
+    _ambient = Color::black;
+    _staticAmbient = Color::clear;
+    _directionalCount = 0;
+    _dynamicDirectionalBlockCount = 0;
+}
+
+void LightClusters::Build(const Camera& camera, const vector<shared_ptr<Light>>& lights)
+{
+    if(camera.GetFieldOfView() != _fov
+    || camera.GetAspectRatio() != _aspect
+    || camera.GetNearPlane() != _nearPlane
+    || camera.GetFarPlane() != _farPlane)
+    {
+        UpdateClusterBounds(camera);
+    }
+
+    _mtxView = camera.GetViewMatrix();
+    _mtxCamera = camera.transform.GetMatrix();
+
+    _globalLights.clear();
+    _localLights.clear();
+    _assignments.clear();
+    _directionalLights.clear();
+    _ambient = Color::black;
+    _staticAmbient = Color::clear;
+
+    for(auto& light : lights)
+    {
+        switch(light->type())
+        {
+        case LightType::Ambient:
+        {
+            auto ambient = (AmbientLight*)light.get();
+            (ambient->isStatic ? _staticAmbient : _ambient) += ambient->color * ambient->intensity;
+            _globalLights.push_back(light.get());
+            break;
+        }
+        case LightType::Directional:
+            _directionalLights.push_back((DirectionalLight*)light.get());
+            _globalLights.push_back(light.get());
+            break;
+        default:
+            PackLocalLight(light.get());
+            break;
+        }
+    }
+
+    PackDirectionalLights();
+
+    // counting sort the (cluster, light) pairs into one compact list
+    fill(_clusterCounts.begin(), _clusterCounts.end(), 0);
+
+    for(auto& a : _assignments)
+        ++_clusterCounts[a.first];
+
+    uint32_t offset = 0;
+    for(int i = 0; i < ClusterCount; ++i)
+    {
+        _clusterOffsets[i] = offset;
+        offset += _clusterCounts[i];
+        _clusterCounts[i] = _clusterOffsets[i];
+    }
+    _clusterOffsets[ClusterCount] = offset;
+
+    _gatheredLists.clear();
+    _gatheredLights.clear();
+
+    _clusterLights.resize(_assignments.size());
+    _clusterLightIndices.resize(_assignments.size());
+
+    for(auto& a : _assignments)
+    {
+        uint32_t i = _clusterCounts[a.first]++;
+        _clusterLightIndices[i] = a.second;
+        _clusterLights[i] = _localLights[a.second].light;
+    }
+
+    PackClusterBlocks();
+}
+
+void LightClusters::PackDirectionalLights()
+{
+    _directionalBlocks.clear();
+    _directionalCount = 0;
+
+    // the blocks point into this, so it must not grow while packing
+    _cascadeBuffers.clear();
+    _cascadeBuffers.reserve(_directionalLights.size());
+
+    for(auto light : _directionalLights)
+    {
+        if(!light->isStatic)
+            PackDirectionalLight(light);
+    }
+
+    _dynamicDirectionalBlockCount = (uint32_t)_directionalBlocks.size();
+
+    // static lights start a new block
+    _directionalCount = (_directionalCount + 3) & ~3u;
+
+    for(auto light : _directionalLights)
+    {
+        if(light->isStatic)
+            PackDirectionalLight(light);
+    }
+}
+
+void LightClusters::PackDirectionalLight(const DirectionalLight* light)
+{
+    int lane = _directionalCount++ & 3;
+    if(lane == 0)
+        _directionalBlocks.push_back(DirectionalLightBlock{});
+
+    Vec3 dir = -light->direction;
+    Color color = light->color * light->intensity;
+
+    DirectionalLightBlock& b = _directionalBlocks.back();
+    b.dirX[lane] = dir.x;
+    b.dirY[lane] = dir.y;
+    b.dirZ[lane] = dir.z;
+    b.colorR[lane] = color.r;
+    b.colorG[lane] = color.g;
+    b.colorB[lane] = color.b;
+    b.colorA[lane] = color.a;
+
+    if(light->castShadows)
+    {
+        // the buffers rendered for this frame, the next one may render the others
+        _cascadeBuffers.push_back(light->shadowMap.buffers());
+        b.shadowMaps[lane] = &_cascadeBuffers.back();
+        b.hasShadows = true;
+    }
+}
+
+void LightClusters::PackLocalLight(Light* light)
+{
+    LocalLight l;
+    l.light = light;
+    l.type = light->type();
+    l.isStatic = light->isStatic;
+
+    float attenMin;
+    float attenMax;
+
+    if(l.type == LightType::Point)
+    {
+        auto point = (PointLight*)light;
+        l.position = point->position;
+        l.direction = Vec3::zero;
+        l.color = point->color * point->intensity;
+        l.cosInner = 0;
+        l.cosScale = 0;
+        l.shadowMap = nullptr;
+        attenMin = point->distAttenMin;
+        attenMax = point->distAttenMax;
+    }
+    else
+    {
+        auto spot = (SpotLight*)light;
+        float cosInner = cos(Math::DegToRad * spot->angAttenMin * 0.5f);
+        float cosOuter = cos(Math::DegToRad * spot->angAttenMax * 0.5f);
+        l.position = spot->position;
+        l.direction = spot->direction;
+        l.color = spot->color * spot->intensity;
+        l.cosInner = cosInner;
+        l.cosScale = 1.0f / Math::Max(cosInner - cosOuter, FLT_EPSILON);
+        l.shadowMap = spot->castShadows ? &spot->shadowMap.buffer() : nullptr;
+        attenMin = spot->distAttenMin;
+        attenMax = spot->distAttenMax;
+    }
+
+    l.attenMin = attenMin;
+    l.attenScale = 1.0f / Math::Max(attenMax - attenMin, FLT_EPSILON);
+
+    uint32_t index = (uint32_t)_localLights.size();
+    _localLights.push_back(l);
+
+    Sphere bounds = light->GetBoundingSphere();
+    bounds.center = Vec4(bounds.center, 1.0f) * _mtxView;
+    AssignLight(index, bounds);
+}
+
+void LightClusters::PackClusterBlocks()
+{
+    _pointBlocks.clear();
+    _spotBlocks.clear();
+
+    for(int c = 0; c < ClusterCount; ++c)
+    {
+        const uint32_t* indices = _clusterLightIndices.data();
+        PackBlocks(indices + _clusterOffsets[c], indices + _clusterOffsets[c + 1], _clusterBlocks[c]);
+    }
+}
+
+void LightClusters::PackBlocks(const uint32_t* first, const uint32_t* last, ClusterBlocks& blocks)
+{
+    blocks.firstPointBlock = (uint32_t)_pointBlocks.size();
+    blocks.firstSpotBlock = (uint32_t)_spotBlocks.size();
+
+    // dynamic lights first, then static lights in blocks of their own
+    PackLights(first, last, false);
+    blocks.dynamicPointBlockCount = (uint32_t)_pointBlocks.size() - blocks.firstPointBlock;
+    blocks.dynamicSpotBlockCount = (uint32_t)_spotBlocks.size() - blocks.firstSpotBlock;
+
+    PackLights(first, last, true);
+    blocks.pointBlockCount = (uint32_t)_pointBlocks.size() - blocks.firstPointBlock;
+    blocks.spotBlockCount = (uint32_t)_spotBlocks.size() - blocks.firstSpotBlock;
+}
+
+void LightClusters::PackLights(const uint32_t* first, const uint32_t* last, bool isStatic)
+{
+    int pointLane = 0;
+    int spotLane = 0;
+
+    for(const uint32_t* i = first; i != last; ++i)
+    {
+        const LocalLight& l = _localLights[*i];
+        if(l.isStatic != isStatic)
+            continue;
+
+        if(l.type == LightType::Point)
+        {
+            if(pointLane == 0)
+                _pointBlocks.push_back(PointLightBlock{});
+
+            PointLightBlock& b = _pointBlocks.back();
+            b.posX[pointLane] = l.position.x;
+            b.posY[pointLane] = l.position.y;
+            b.posZ[pointLane] = l.position.z;
+            b.attenMin[pointLane] = l.attenMin;
+            b.attenScale[pointLane] = l.attenScale;
+            b.colorR[pointLane] = l.color.r;
+            b.colorG[pointLane] = l.color.g;
+            b.colorB[pointLane] = l.color.b;
+            b.colorA[pointLane] = l.color.a;
+            pointLane = (pointLane + 1) & 3;
+        }
+        else
+        {
+            if(spotLane == 0)
+                _spotBlocks.push_back(SpotLightBlock{});
+
+            SpotLightBlock& b = _spotBlocks.back();
+            b.posX[spotLane] = l.position.x;
+            b.posY[spotLane] = l.position.y;
+            b.posZ[spotLane] = l.position.z;
+            b.dirX[spotLane] = l.direction.x;
+            b.dirY[spotLane] = l.direction.y;
+            b.dirZ[spotLane] = l.direction.z;
+            b.attenMin[spotLane] = l.attenMin;
+            b.attenScale[spotLane] = l.attenScale;
+            b.cosInner[spotLane] = l.cosInner;
+            b.cosScale[spotLane] = l.cosScale;
+            b.colorR[spotLane] = l.color.r;
+            b.colorG[spotLane] = l.color.g;
+            b.colorB[spotLane] = l.color.b;
+            b.colorA[spotLane] = l.color.a;
+
+            if(l.shadowMap)
+            {
+                b.shadowMaps[spotLane] = l.shadowMap;
+                b.hasShadows = true;
+            }
+
+            spotLane = (spotLane + 1) & 3;
+        }
+    }
+}
+
+void LightClusters::UpdateClusterBounds(const Camera& camera)
+{
+    _fov = camera.GetFieldOfView();
+    _aspect = camera.GetAspectRatio();
+    _nearPlane = camera.GetNearPlane();
+    _farPlane = camera.GetFarPlane();
+
+    // must match Mat4::Project3D
+    _scaleX = 1.0f / tan(Math::DegToRad * _fov * 0.5f);
+    _scaleY = _scaleX * _aspect;
+
+    float depthRange = log2(_farPlane / _nearPlane);
+    _sliceScale = (float)Slices / depthRange;
+    _sliceBias = -log2(_nearPlane) * _sliceScale;
+
+    for(int s = 0; s < Slices; ++s)
+    {
+        float zn = _nearPlane * exp2(depthRange * (float)s / (float)Slices);
+        float zf = _nearPlane * exp2(depthRange * (float)(s + 1) / (float)Slices);
+
+        for(int ty = 0; ty < TilesY; ++ty)
+        {
+            // tiles rows go top to bottom in screen space
+            float y1 = 1.0f - 2.0f * (float)ty / (float)TilesY;
+            float y0 = y1 - 2.0f / (float)TilesY;
+
+            for(int tx = 0; tx < TilesX; ++tx)
+            {
+                float x0 = -1.0f + 2.0f * (float)tx / (float)TilesX;
+                float x1 = x0 + 2.0f / (float)TilesX;
+
+                ClusterBounds& b = _bounds[(s * TilesY + ty) * TilesX + tx];
+                b.vmin = Vec3(Math::Min(x0 * zn, x0 * zf) / _scaleX, Math::Min(y0 * zn, y0 * zf) / _scaleY, zn);
+                b.vmax = Vec3(Math::Max(x1 * zn, x1 * zf) / _scaleX, Math::Max(y1 * zn, y1 * zf) / _scaleY, zf);
+            }
+        }
+    }
+}
+
+void LightClusters::AssignLight(uint32_t lightIndex, const Sphere& viewBounds)
+{
+    Light* light = _localLights[lightIndex].light;
+
+    const Vec3& c = viewBounds.center;
+    float r = viewBounds.radius;
+
+    float zmin = c.z - r;
+    float zmax = c.z + r;
+
+    if(zmax <= _nearPlane || zmin >= _farPlane)
+        return;
+
+    int s0 = Math::Clamp(Math::Floor(log2(Math::Max(zmin, _nearPlane)) * _sliceScale + _sliceBias), 0, Slices - 1);
+    int s1 = Math::Clamp(Math::Floor(log2(Math::Min(zmax, _farPlane)) * _sliceScale + _sliceBias), 0, Slices - 1);
+
+    int tx0 = 0;
+    int tx1 = TilesX - 1;
+    int ty0 = 0;
+    int ty1 = TilesY - 1;
+
+    // conservative screen extents of the sphere, unless it straddles the near plane
+    if(zmin > _nearPlane)
+    {
+        float x0 = c.x - r;
+        float x1 = c.x + r;
+        float y0 = c.y - r;
+        float y1 = c.y + r;
+
+        float nx0 = (x0 < 0 ? x0 / zmin : x0 / zmax) * _scaleX;
+        float nx1 = (x1 > 0 ? x1 / zmin : x1 / zmax) * _scaleX;
+        float ny0 = (y0 < 0 ? y0 / zmin : y0 / zmax) * _scaleY;
+        float ny1 = (y1 > 0 ? y1 / zmin : y1 / zmax) * _scaleY;
+
+        if(nx1 < -1.0f || nx0 > 1.0f || ny1 < -1.0f || ny0 > 1.0f)
+            return;
+
+        tx0 = Math::Clamp(Math::Floor((nx0 + 1.0f) * 0.5f * TilesX), 0, TilesX - 1);
+        tx1 = Math::Clamp(Math::Floor((nx1 + 1.0f) * 0.5f * TilesX), 0, TilesX - 1);
+        ty0 = Math::Clamp(Math::Floor((1.0f - ny1) * 0.5f * TilesY), 0, TilesY - 1);
+        ty1 = Math::Clamp(Math::Floor((1.0f - ny0) * 0.5f * TilesY), 0, TilesY - 1);
+    }
+
+    float rSq = r * r;
+
+    for(int s = s0; s <= s1; ++s)
+    {
+        for(int ty = ty0; ty <= ty1; ++ty)
+        {
+            for(int tx = tx0; tx <= tx1; ++tx)
+            {
+                uint32_t index = (s * TilesY + ty) * TilesX + tx;
+                const ClusterBounds& b = _bounds[index];
+
+                // sphere vs. view space box
+                Vec3 p(Math::Clamp(c.x, b.vmin.x, b.vmax.x),
+                       Math::Clamp(c.y, b.vmin.y, b.vmax.y),
+                       Math::Clamp(c.z, b.vmin.z, b.vmax.z));
+
+                if(p.DistanceSq(c) > rSq)
+                    continue;
+
+                // let the light refine the test against its actual shape (spot cone)
+                Vec3 center = (b.vmin + b.vmax) * 0.5f;
+                Sphere clusterBounds(Vec4(center, 1.0f) * _mtxCamera, center.Distance(b.vmax));
+
+                if(light->CanAffect(clusterBounds))
+                    _assignments.emplace_back(index, lightIndex);
+            }
+        }
+    }
+}
+
+LightRange LightClusters::GetGlobalLights() const
+{
+    Light* const* lights = _globalLights.data();
+    return { lights, lights + _globalLights.size() };
+}
+
+LightRange LightClusters::GetLights(const Vec3& worldPos) const
+{
+    return GetClusterLights(GetClusterIndex(worldPos));
+}
+
+int LightClusters::GetClusterIndex(const Vec3& worldPos) const
+{
+    Vec3 v = Vec4(worldPos, 1.0f) * _mtxView;
+
+    float z = Math::Max(v.z, _nearPlane);
+    float rz = 1.0f / z;
+
+    int tx = Math::Clamp(Math::Floor((v.x * _scaleX * rz + 1.0f) * 0.5f * TilesX), 0, TilesX - 1);
+    int ty = Math::Clamp(Math::Floor((1.0f - v.y * _scaleY * rz) * 0.5f * TilesY), 0, TilesY - 1);
+    int s = Math::Clamp(Math::Floor(log2(z) * _sliceScale + _sliceBias), 0, Slices - 1);
+
+    return (s * TilesY + ty) * TilesX + tx;
+}
+
+LightRange LightClusters::GetClusterLights(int cluster) const
+{
+    Light* const* lights = _clusterLights.data();
+    return { lights + _clusterOffsets[cluster], lights + _clusterOffsets[cluster + 1] };
+}
+
+uint32_t LightClusters::GatherLights(const Sphere& worldBounds)
+{
+    GatheredLights list;
+    list.firstLight = (uint32_t)_gatheredLights.size();
+
+    // every light is tested, not just the ones binned to clusters on screen
+    _gatheredIndices.clear();
+
+    for(uint32_t i = 0; i < (uint32_t)_localLights.size(); ++i)
+    {
+        if(_localLights[i].light->CanAffect(worldBounds))
+        {
+            _gatheredIndices.push_back(i);
+            _gatheredLights.push_back(_localLights[i].light);
+        }
+    }
+
+    list.lightCount = (uint32_t)_gatheredLights.size() - list.firstLight;
+
+    const uint32_t* indices = _gatheredIndices.data();
+    PackBlocks(indices, indices + _gatheredIndices.size(), list.blocks);
+
+    _gatheredLists.push_back(list);
+    return (uint32_t)_gatheredLists.size() - 1;
+}
+
+LightRange LightClusters::GetGatheredLights(uint32_t lightList) const
+{
+    const GatheredLights& list = _gatheredLists[lightList];
+    Light* const* lights = _gatheredLights.data() + list.firstLight;
+    return { lights, lights + list.lightCount };
+}
+
+#if USE_SSE
+// scales each lit lane by the fraction of its light that reaches the surface
+template<class T>
+static __m128 ApplyShadows(__m128 w, const T* const (&shadowMaps)[4], const Vec3& worldPos, const Vec3& normal)
+{
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, w);
+
+    for(int i = 0; i < 4; ++i)
+    {
+        if(shadowMaps[i] && lanes[i] > 0)
+            lanes[i] *= shadowMaps[i]->Sample(worldPos, normal);
+    }
+
+    return _mm_load_ps(lanes);
+}
+#endif
+
+Color LightClusters::Illuminate(const Vec3& worldPos, const Vec3& normal, bool includeStatic) const
+{
+    int cluster = GetClusterIndex(worldPos);
+#if USE_SSE
+    return Illuminate(_clusterBlocks[cluster], worldPos, normal, includeStatic);
+#else
+    return Illuminate(GetClusterLights(cluster), worldPos, normal, includeStatic);
+#endif
+}
+
+Color LightClusters::IlluminateGathered(uint32_t lightList, const Vec3& worldPos, const Vec3& normal, bool includeStatic) const
+{
+#if USE_SSE
+    return Illuminate(_gatheredLists[lightList].blocks, worldPos, normal, includeStatic);
+#else
+    return Illuminate(GetGatheredLights(lightList), worldPos, normal, includeStatic);
+#endif
+}
+
+#if USE_SSE
+Color LightClusters::Illuminate(const ClusterBlocks& cluster, const Vec3& worldPos, const Vec3& normal, bool includeStatic) const
+{
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minDistSq = _mm_set1_ps(FLT_MIN);
+
+    __m128 px = _mm_set1_ps(worldPos.x);
+    __m128 py = _mm_set1_ps(worldPos.y);
+    __m128 pz = _mm_set1_ps(worldPos.z);
+    __m128 nx = _mm_set1_ps(normal.x);
+    __m128 ny = _mm_set1_ps(normal.y);
+    __m128 nz = _mm_set1_ps(normal.z);
+
+    __m128 accR = zero;
+    __m128 accG = zero;
+    __m128 accB = zero;
+    __m128 accA = zero;
+
+    const DirectionalLightBlock* dirEnd = _directionalBlocks.data()
+        + (includeStatic ? _directionalBlocks.size() : _dynamicDirectionalBlockCount);
+
+    for(const DirectionalLightBlock* pb = _directionalBlocks.data(); pb != dirEnd; ++pb)
+    {
+        const DirectionalLightBlock& b = *pb;
+
+        __m128 cn = _mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(nx, _mm_load_ps(b.dirX)),
+            _mm_mul_ps(ny, _mm_load_ps(b.dirY))),
+            _mm_mul_ps(nz, _mm_load_ps(b.dirZ)));
+        cn = _mm_max_ps(cn, zero);
+
+        if(b.hasShadows)
+            cn = ApplyShadows(cn, b.shadowMaps, worldPos, normal);
+
+        accR = _mm_add_ps(accR, _mm_mul_ps(cn, _mm_load_ps(b.colorR)));
+        accG = _mm_add_ps(accG, _mm_mul_ps(cn, _mm_load_ps(b.colorG)));
+        accB = _mm_add_ps(accB, _mm_mul_ps(cn, _mm_load_ps(b.colorB)));
+        accA = _mm_add_ps(accA, _mm_mul_ps(cn, _mm_load_ps(b.colorA)));
+    }
+
+    const PointLightBlock* point = _pointBlocks.data() + cluster.firstPointBlock;
+    const PointLightBlock* pointEnd = point + (includeStatic ? cluster.pointBlockCount : cluster.dynamicPointBlockCount);
+
+    for( ; point != pointEnd; ++point)
+    {
+        // vector towards the light
+        __m128 lx = _mm_sub_ps(_mm_load_ps(point->posX), px);
+        __m128 ly = _mm_sub_ps(_mm_load_ps(point->posY), py);
+        __m128 lz = _mm_sub_ps(_mm_load_ps(point->posZ), pz);
+
+        __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lx, lx), _mm_mul_ps(ly, ly)), _mm_mul_ps(lz, lz));
+        __m128 invDist = _mm_rsqrt_ps(_mm_max_ps(distSq, minDistSq));
+        __m128 dist = _mm_mul_ps(distSq, invDist);
+
+        __m128 cn = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, lx), _mm_mul_ps(ny, ly)), _mm_mul_ps(nz, lz));
+        cn = _mm_max_ps(_mm_mul_ps(cn, invDist), zero);
+
+        // lights beyond distAttenMax saturate to 1 here and contribute nothing
+        __m128 cd = _mm_mul_ps(_mm_sub_ps(dist, _mm_load_ps(point->attenMin)), _mm_load_ps(point->attenScale));
+        cd = _mm_min_ps(_mm_max_ps(cd, zero), one);
+        cd = _mm_sub_ps(one, _mm_mul_ps(cd, cd));
+
+        __m128 w = _mm_mul_ps(cn, cd);
+        accR = _mm_add_ps(accR, _mm_mul_ps(w, _mm_load_ps(point->colorR)));
+        accG = _mm_add_ps(accG, _mm_mul_ps(w, _mm_load_ps(point->colorG)));
+        accB = _mm_add_ps(accB, _mm_mul_ps(w, _mm_load_ps(point->colorB)));
+        accA = _mm_add_ps(accA, _mm_mul_ps(w, _mm_load_ps(point->colorA)));
+    }
+
+    const SpotLightBlock* spot = _spotBlocks.data() + cluster.firstSpotBlock;
+    const SpotLightBlock* spotEnd = spot + (includeStatic ? cluster.spotBlockCount : cluster.dynamicSpotBlockCount);
+
+    for( ; spot != spotEnd; ++spot)
+    {
+        __m128 lx = _mm_sub_ps(_mm_load_ps(spot->posX), px);
+        __m128 ly = _mm_sub_ps(_mm_load_ps(spot->posY), py);
+        __m128 lz = _mm_sub_ps(_mm_load_ps(spot->posZ), pz);
+
+        __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lx, lx), _mm_mul_ps(ly, ly)), _mm_mul_ps(lz, lz));
+        __m128 invDist = _mm_rsqrt_ps(_mm_max_ps(distSq, minDistSq));
+        __m128 dist = _mm_mul_ps(distSq, invDist);
+
+        __m128 cn = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, lx), _mm_mul_ps(ny, ly)), _mm_mul_ps(nz, lz));
+        cn = _mm_max_ps(_mm_mul_ps(cn, invDist), zero);
+
+        __m128 cd = _mm_mul_ps(_mm_sub_ps(dist, _mm_load_ps(spot->attenMin)), _mm_load_ps(spot->attenScale));
+        cd = _mm_min_ps(_mm_max_ps(cd, zero), one);
+        cd = _mm_sub_ps(one, _mm_mul_ps(cd, cd));
+
+        // cosine of the angle between the spot direction and the light->surface vector,
+        // surfaces outside the outer cone saturate to 1 and contribute nothing
+        __m128 cosAng = _mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(_mm_load_ps(spot->dirX), lx),
+            _mm_mul_ps(_mm_load_ps(spot->dirY), ly)),
+            _mm_mul_ps(_mm_load_ps(spot->dirZ), lz));
+        cosAng = _mm_sub_ps(zero, _mm_mul_ps(cosAng, invDist));
+
+        __m128 ca = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(spot->cosInner), cosAng), _mm_load_ps(spot->cosScale));
+        ca = _mm_min_ps(_mm_max_ps(ca, zero), one);
+        ca = _mm_sub_ps(one, _mm_mul_ps(ca, ca));
+
+        __m128 w = _mm_mul_ps(_mm_mul_ps(cn, cd), ca);
+
+        if(spot->hasShadows)
+            w = ApplyShadows(w, spot->shadowMaps, worldPos, normal);
+
+        accR = _mm_add_ps(accR, _mm_mul_ps(w, _mm_load_ps(spot->colorR)));
+        accG = _mm_add_ps(accG, _mm_mul_ps(w, _mm_load_ps(spot->colorG)));
+        accB = _mm_add_ps(accB, _mm_mul_ps(w, _mm_load_ps(spot->colorB)));
+        accA = _mm_add_ps(accA, _mm_mul_ps(w, _mm_load_ps(spot->colorA)));
+    }
+
+    // sum the lanes of each channel
+    _MM_TRANSPOSE4_PS(accR, accG, accB, accA);
+    __m128 lum = _mm_add_ps(_mm_add_ps(accR, accG), _mm_add_ps(accB, accA));
+
+    lum = _mm_add_ps(lum, _ambient.m);
+
+    if(includeStatic)
+        lum = _mm_add_ps(lum, _staticAmbient.m);
+
+    return Color(lum);
+}
+#else
+Color LightClusters::Illuminate(LightRange lights, const Vec3& worldPos, const Vec3& normal, bool includeStatic) const
+{
+    Color lum = Color::black;
+
+    for(auto light : GetGlobalLights())
+    {
+        if(includeStatic || !light->isStatic)
+            lum += light->Apply(worldPos, normal, Vec3::zero, Vec3::zero);
+    }
+
+    for(auto light : lights)
+    {
+        if(includeStatic || !light->isStatic)
+            lum += light->Apply(worldPos, normal, Vec3::zero, Vec3::zero);
+    }
+
+    return lum;
+}
+#endif
@@ -0,0 +1,208 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Math.h"
+#include "Mem.h"
+#include "Light.h"
+using namespace std;
+
+class Camera;
+
+struct LightRange
+{
+    Light* const* first;
+    Light* const* last;
+
+    Light* const* begin() const { return first; }
+    Light* const* end() const { return last; }
+    bool empty() const { return first == last; }
+    size_t size() const { return last - first; }
+};
+
+// Lights are packed four to a block in SoA form with everything the per-pixel
+// evaluation needs precomputed. Unused lanes are zeroed, which makes them black.
+// Dynamic lights are packed ahead of static ones so that lightmapped surfaces
+// can stop after the dynamic blocks.
+
+struct alignas(16) DirectionalLightBlock
+{
+    float dirX[4];       // direction towards the light
+    float dirY[4];
+    float dirZ[4];
+    float colorR[4];     // color * intensity
+    float colorG[4];
+    float colorB[4];
+    float colorA[4];
+    const CascadedShadowMap::Buffers* shadowMaps[4];
+    bool hasShadows;
+};
+
+struct alignas(16) PointLightBlock
+{
+    float posX[4];
+    float posY[4];
+    float posZ[4];
+    float attenMin[4];   // distAttenMin
+    float attenScale[4]; // 1 / (distAttenMax - distAttenMin)
+    float colorR[4];     // color * intensity
+    float colorG[4];
+    float colorB[4];
+    float colorA[4];
+};
+
+struct alignas(16) SpotLightBlock
+{
+    float posX[4];
+    float posY[4];
+    float posZ[4];
+    float dirX[4];
+    float dirY[4];
+    float dirZ[4];
+    float attenMin[4];   // distAttenMin
+    float attenScale[4]; // 1 / (distAttenMax - distAttenMin)
+    float cosInner[4];   // cos(angAttenMin / 2)
+    float cosScale[4];   // 1 / (cos(angAttenMin / 2) - cos(angAttenMax / 2))
+    float colorR[4];     // color * intensity
+    float colorG[4];
+    float colorB[4];
+    float colorA[4];
+    const ShadowMap::Buffer* shadowMaps[4];
+    bool hasShadows;
+};
+
+// bins local lights into a view space froxel grid (screen tiles x exponential depth slices)
+// so that pixels only evaluate the lights that can actually reach them
+class LightClusters
+{
+public:
+    static constexpr int TilesX = 16;
+    static constexpr int TilesY = 8;
+    static constexpr int Slices = 24;
+    static constexpr int ClusterCount = TilesX * TilesY * Slices;
+
+    LightClusters();
+
+    void Build(const Camera& camera, const vector<shared_ptr<Light>>& lights);
+
+    // sum of all lights reaching 'worldPos', evaluated without virtual dispatch.
+    // static lights are left out if 'includeStatic' is false (they come from a lightmap).
+    Color Illuminate(const Vec3& worldPos, const Vec3& normal, bool includeStatic = true) const;
+
+    // lights that affect everything (ambient, directional)
+    LightRange GetGlobalLights() const;
+
+    // local lights that can affect the cluster containing 'worldPos'
+    LightRange GetLights(const Vec3& worldPos) const;
+
+    int GetClusterIndex(const Vec3& worldPos) const;
+    LightRange GetClusterLights(int cluster) const;
+
+    // the local lights that can reach anything inside 'worldBounds', packed into a list of their own.
+    // for surfaces that can't be looked up in the clusters, like the vertices of a vertex lit object,
+    // which can be off screen or behind the camera, where the clusters don't have every light that
+    // reaches them. returns the list to illuminate with, which lasts until the next Build().
+    uint32_t GatherLights(const Sphere& worldBounds);
+    LightRange GetGatheredLights(uint32_t lightList) const;
+
+    // like Illuminate(), with the lights of a list from GatherLights() instead of a cluster's
+    Color IlluminateGathered(uint32_t lightList, const Vec3& worldPos, const Vec3& normal, bool includeStatic = true) const;
+
+private:
+    struct ClusterBounds
+    {
+        Vec3 vmin;
+        Vec3 vmax;
+    };
+
+    // scalar kernel inputs of a point or spot light, computed once per frame
+    struct LocalLight
+    {
+        Light* light;
+        LightType type;
+        Vec3 position;
+        Vec3 direction;
+        Color color;
+        float attenMin;
+        float attenScale;
+        float cosInner;
+        float cosScale;
+        const ShadowMap::Buffer* shadowMap;
+        bool isStatic;
+    };
+
+    // the blocks of a cluster, or of a list of gathered lights
+    struct ClusterBlocks
+    {
+        uint32_t firstPointBlock;
+        uint32_t pointBlockCount;
+        uint32_t dynamicPointBlockCount;
+        uint32_t firstSpotBlock;
+        uint32_t spotBlockCount;
+        uint32_t dynamicSpotBlockCount;
+    };
+
+    struct GatheredLights
+    {
+        ClusterBlocks blocks;
+        uint32_t firstLight; // in _gatheredLights
+        uint32_t lightCount;
+    };
+
+    void UpdateClusterBounds(const Camera& camera);
+    void AssignLight(uint32_t lightIndex, const Sphere& viewBounds);
+    void PackDirectionalLights();
+    void PackDirectionalLight(const DirectionalLight* light);
+    void PackLocalLight(Light* light);
+    void PackClusterBlocks();
+    void PackBlocks(const uint32_t* first, const uint32_t* last, ClusterBlocks& blocks);
+    void PackLights(const uint32_t* first, const uint32_t* last, bool isStatic);
+#if USE_SSE
+    Color Illuminate(const ClusterBlocks& blocks, const Vec3& worldPos, const Vec3& normal, bool includeStatic) const;
+#else
+    Color Illuminate(LightRange lights, const Vec3& worldPos, const Vec3& normal, bool includeStatic) const;
+#endif
+
+    // projection the cluster bounds were built for
+    float _fov;
+    float _aspect;
+    float _nearPlane;
+    float _farPlane;
+
+    Mat4 _mtxView;
+    Mat4 _mtxCamera;
+    float _scaleX;
+    float _scaleY;
+    float _sliceScale;
+    float _sliceBias;
+
+    vector<ClusterBounds, AlignedAllocator<ClusterBounds, 16>> _bounds;
+    vector<Light*> _globalLights;
+    vector<LocalLight, AlignedAllocator<LocalLight, 16>> _localLights;
+    vector<Light*> _clusterLights;
+    vector<uint32_t> _clusterLightIndices;
+    vector<uint32_t> _clusterOffsets;
+    vector<uint32_t> _clusterCounts;
+    vector<pair<uint32_t, uint32_t>> _assignments;
+
+    Color _ambient;
+    Color _staticAmbient;
+    vector<const DirectionalLight*> _directionalLights;
+    vector<CascadedShadowMap::Buffers> _cascadeBuffers;
+    uint32_t _directionalCount;
+    uint32_t _dynamicDirectionalBlockCount;
+    vector<DirectionalLightBlock, AlignedAllocator<DirectionalLightBlock, 16>> _directionalBlocks;
+    vector<PointLightBlock, AlignedAllocator<PointLightBlock, 16>> _pointBlocks;
+    vector<SpotLightBlock, AlignedAllocator<SpotLightBlock, 16>> _spotBlocks;
+    vector<ClusterBlocks> _clusterBlocks;
+
+    // lists from GatherLights(), their blocks are packed after the clusters'
+    vector<GatheredLights> _gatheredLists;
+    vector<Light*> _gatheredLights;
+    vector<uint32_t> _gatheredIndices; // local lights of the list being gathered
+};
@@ -0,0 +1,274 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "LightmapBaker.h"
+#include "JobSystem.h"
+#include "Light.h"
+#include "Model.h"
+#include "Scene.h"
+#include "SceneObject.h"
+#include "Texture.h"
+#include "TargaImage.h"
+#include <cmath>
+#include <fstream>
+
+LightmapBaker::LightmapBaker(JobSystem& jobSystem)
+{
+    _jobSystem = &jobSystem;
+}
+
+void LightmapBaker::Bake(Scene* scene, const string& directory)
+{
+    vector<Light*> lights;
+
+    for(auto& light : scene->lights)
+    {
+        if(light->isStatic)
+        {
+            light->Update();
+            lights.push_back(light.get());
+        }
+    }
+
+    for(auto& obj : scene->objects)
+    {
+        if(!obj->isStatic || obj->model->vertices.empty())
+            continue;
+
+        Model& model = *obj->model;
+        if(!model.hasLightmapCoords)
+            GenerateLightmapCoords(model);
+
+        Sphere bounds = obj->GetWorldBoundingSphere();
+        vector<Light*> objLights;
+
+        for(auto light : lights)
+        {
+            if(light->CanAffect(bounds))
+                objLights.push_back(light);
+        }
+
+        Mat4 mtxModel = obj->transform.GetMatrix();
+        Mat4 mtxNormal = obj->transform.GetInverseMatrix().Transposed();
+
+        uint32_t size = GetResolution(model);
+        ColorBuffer texels(size * size, Color::clear);
+        vector<uint8_t> coverage(size * size, 0);
+
+        // many small strips, so that threads stay busy when the triangles are unevenly spread
+        constexpr int StripHeight = 16;
+        size_t stripCount = (size + StripHeight - 1) / StripHeight;
+
+        _jobSystem->ParallelFor(stripCount, [&](size_t i)
+        {
+            int firstRow = (int)i * StripHeight;
+            int lastRow = min(firstRow + StripHeight, (int)size);
+            BakeRows(model, mtxModel, mtxNormal, objLights, size, firstRow, lastRow, texels, coverage);
+        });
+
+        Dilate(size, texels, coverage);
+
+        unique_ptr<Color32[]> pixels = make_unique<Color32[]>(size * size);
+
+        for(uint32_t i = 0; i < size * size; ++i)
+        {
+            Color c = Color::Clamp(texels[i] * (1.0f / Range));
+            c.a = 1.0f;
+            pixels[i] = c;
+        }
+
+        TargaImage image(move(pixels), (int)size, (int)size, 4);
+        image.Save(GetLightmapPath(directory, *obj));
+
+        obj->lightmap = AlignedMakeShared<Texture, 16>(image.pixels.get(), size, size, FilterMode::Bilinear);
+    }
+}
+
+void LightmapBaker::Load(Scene* scene, const string& directory)
+{
+    for(auto& obj : scene->objects)
+    {
+        if(!obj->isStatic || obj->model->vertices.empty())
+            continue;
+
+        // the generated layout is the same every time, so it matches what was baked
+        if(!obj->model->hasLightmapCoords)
+            GenerateLightmapCoords(*obj->model);
+
+        string path = GetLightmapPath(directory, *obj);
+
+        if(ifstream(path))
+            obj->lightmap = AlignedMakeShared<Texture, 16>(path, FilterMode::Bilinear);
+        else
+            obj->lightmap.reset();
+    }
+}
+
+void LightmapBaker::GenerateLightmapCoords(Model& model)
+{
+    size_t triCount = model.vertices.size() / 3;
+    size_t cellCount = (triCount + 1) / 2;
+    int gridSize = max((int)ceil(sqrt((double)cellCount)), 1);
+
+    // each cell holds two right triangles facing each other across the diagonal,
+    // with a gap between them and around the cell so their texels don't bleed together
+    float cell = 1.0f / (float)gridSize;
+    float gap = cell * 0.125f;
+    float lo = gap;
+    float hi = cell - gap;
+
+    for(size_t t = 0; t < triCount; ++t)
+    {
+        size_t c = t / 2;
+        Vec2 origin((float)(c % gridSize) * cell, (float)(c / gridSize) * cell);
+        Vertex* tri = &model.vertices[t * 3];
+
+        if((t & 1) == 0)
+        {
+            tri[0].lightmapCoord = origin + Vec2(lo, lo);
+            tri[1].lightmapCoord = origin + Vec2(hi - gap, lo);
+            tri[2].lightmapCoord = origin + Vec2(lo, hi - gap);
+        }
+        else
+        {
+            tri[0].lightmapCoord = origin + Vec2(hi, hi);
+            tri[1].lightmapCoord = origin + Vec2(lo + gap, hi);
+            tri[2].lightmapCoord = origin + Vec2(hi, lo + gap);
+        }
+    }
+
+    model.hasLightmapCoords = true;
+    model.lightmapGridSize = gridSize;
+    model.VerticesChanged();
+}
+
+string LightmapBaker::GetLightmapPath(const string& directory, const SceneObject& obj) {
+    return directory + "/" + obj.name + ".tga";
+}
+
+uint32_t LightmapBaker::GetResolution(const Model& model) const
+{
+    if(model.lightmapGridSize == 0)
+        return resolution;
+
+    // about 8 texels across each cell of a generated layout
+    int size = Math::NextPowerOfTwo(model.lightmapGridSize * 8);
+    return (uint32_t)Math::Clamp(size, (int)minResolution, (int)maxResolution);
+}
+
+void LightmapBaker::BakeRows(const Model& model, const Mat4& mtxModel, const Mat4& mtxNormal,
+                             const vector<Light*>& lights, uint32_t size, int firstRow, int lastRow,
+                             ColorBuffer& texels, vector<uint8_t>& coverage) const
+{
+    // texel centers sit at whole texel coordinates, matching Texture::GetBilinear
+    const float scale = (float)size;
+    const float eps = -1e-4f;
+    const int maxX = (int)size - 1;
+
+    const Vertex* verts = model.vertices.data();
+    size_t vertCount = model.vertices.size();
+
+    for(size_t i = 0; i + 2 < vertCount; i += 3)
+    {
+        const Vertex& v0 = verts[i];
+        const Vertex& v1 = verts[i + 1];
+        const Vertex& v2 = verts[i + 2];
+
+        Vec2 p0 = v0.lightmapCoord * scale;
+        Vec2 p1 = v1.lightmapCoord * scale;
+        Vec2 p2 = v2.lightmapCoord * scale;
+
+        int y0 = Math::Max(Math::Ceil(Math::Min(p0.y, p1.y, p2.y)), firstRow);
+        int y1 = Math::Min(Math::Floor(Math::Max(p0.y, p1.y, p2.y)), lastRow - 1);
+        if(y0 > y1)
+            continue;
+
+        int x0 = Math::Max(Math::Ceil(Math::Min(p0.x, p1.x, p2.x)), 0);
+        int x1 = Math::Min(Math::Floor(Math::Max(p0.x, p1.x, p2.x)), maxX);
+        if(x0 > x1)
+            continue;
+
+        BarycentricTriangle tri(p0, p1, p2);
+        if(tri.empty())
+            continue;
+
+        for(int y = y0; y <= y1; ++y)
+        {
+            for(int x = x0; x <= x1; ++x)
+            {
+                Vec3 bc = tri.GetCoordinates(Vec2((float)x, (float)y));
+                if(bc.x < eps || bc.y < eps || bc.z < eps)
+                    continue;
+
+                Vec3 pos = v0.worldPos * bc.x + v1.worldPos * bc.y + v2.worldPos * bc.z;
+                Vec3 norm = v0.normal * bc.x + v1.normal * bc.y + v2.normal * bc.z;
+
+                Vec3 worldPos = Vec4(pos, 1.0f) * mtxModel;
+                Vec3 normal = Vec4(norm, 1.0f) * mtxNormal;
+                normal.Normalize();
+
+                Color lum = Color::clear;
+
+                for(auto light : lights)
+                    lum += light->Apply(worldPos, normal, Vec3::zero, Vec3::zero);
+
+                uint32_t index = y * size + x;
+                texels[index] = lum;
+                coverage[index] = 1;
+            }
+        }
+    }
+}
+
+void LightmapBaker::Dilate(uint32_t size, ColorBuffer& texels, vector<uint8_t>& coverage) const
+{
+    int w = (int)size;
+    vector<uint32_t> grown;
+
+    for(int pass = 0; pass < dilation; ++pass)
+    {
+        grown.clear();
+
+        for(int y = 0; y < w; ++y)
+        {
+            for(int x = 0; x < w; ++x)
+            {
+                uint32_t index = y * w + x;
+                if(coverage[index])
+                    continue;
+
+                Color sum = Color::clear;
+                int count = 0;
+
+                for(int ny = Math::Max(y - 1, 0); ny <= Math::Min(y + 1, w - 1); ++ny)
+                {
+                    for(int nx = Math::Max(x - 1, 0); nx <= Math::Min(x + 1, w - 1); ++nx)
+                    {
+                        uint32_t n = ny * w + nx;
+                        if(coverage[n] == 1)
+                        {
+                            sum += texels[n];
+                            ++count;
+                        }
+                    }
+                }
+
+                if(count > 0)
+                {
+                    texels[index] = sum * (1.0f / (float)count);
+                    coverage[index] = 2;
+                    grown.push_back(index);
+                }
+            }
+        }
+
+        if(grown.empty())
+            break;
+
+        // texels grown in this pass only become sources for the next one
+        for(auto index : grown)
+            coverage[index] = 1;
+    }
+}
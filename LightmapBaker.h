@@ -0,0 +1,64 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Math.h"
+#include "Mem.h"
+using namespace std;
+
+class JobSystem;
+class Light;
+class Model;
+class Scene;
+class SceneObject;
+
+// Bakes the lighting from a scene's static lights into one lightmap per static object.
+// Lightmaps are looked up with Vertex::lightmapCoord and store the lighting divided
+// by Range, so that surfaces lit above 1.0 survive the 8 bit encoding.
+class LightmapBaker
+{
+public:
+    static constexpr float Range = 2.0f;
+
+    // lightmap size for models that come with their own lightmap coordinates
+    uint32_t resolution = 256;
+
+    // size limits for models using generated lightmap coordinates
+    uint32_t minResolution = 64;
+    uint32_t maxResolution = 1024;
+
+    // how many texels the baked triangles are grown by, to hide seams when filtering
+    int dilation = 4;
+
+    LightmapBaker(JobSystem& jobSystem);
+
+    // bakes every static object and saves the results as '<directory>/<object name>.tga'
+    void Bake(Scene* scene, const string& directory);
+
+    // assigns previously baked lightmaps to the static objects of 'scene'.
+    // objects that don't have one stay lit per pixel.
+    static void Load(Scene* scene, const string& directory);
+
+    // gives a model without a second uv set its own lightmap layout,
+    // placing each pair of triangles in a cell of a square grid
+    static void GenerateLightmapCoords(Model& model);
+
+private:
+    typedef vector<Color, AlignedAllocator<Color, 16>> ColorBuffer;
+
+    static string GetLightmapPath(const string& directory, const SceneObject& obj);
+
+    uint32_t GetResolution(const Model& model) const;
+    void BakeRows(const Model& model, const Mat4& mtxModel, const Mat4& mtxNormal,
+                  const vector<Light*>& lights, uint32_t size, int firstRow, int lastRow,
+                  ColorBuffer& texels, vector<uint8_t>& coverage) const;
+    void Dilate(uint32_t size, ColorBuffer& texels, vector<uint8_t>& coverage) const;
+
+    JobSystem* _jobSystem;
+};
@@ -7,6 +7,7 @@
 #include <Windowsx.h>
 #include <SDKDDKVer.h>
 #include <stdlib.h>
+#include <cstring>
 #include <memory>
 #include "RenderingContext.h"
 #include "Texture.h"
@@ -15,10 +16,18 @@
 #include "Model.h"
 #include "Camera.h"
 #include "SceneObject.h"
+#include "InstancedObject.h"
 #include "Scene.h"
 #include "Mem.h"
 #include "Application.h"
 #include "CustomShaders.h"
+#include "LightmapBaker.h"
+#include "JobSystem.h"
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "WorldStreamer.h"
+#include <iostream>
+#include <random>
 #include <thread>
 using namespace std;
 
@@ -36,6 +45,38 @@ using namespace std;
 //   F:    cycle antialiasing (None, 4x MSAA, 2x SSAA, 4x SSAA)
 //   C:    toggle framerate cap
 //   R:    reload scene_settings.json
+//   B:    bake lightmaps
+//   P:    toggle frame pipelining
+//
+// Running with "-pack" writes the assets below to assets.pack and quits.
+// The next runs load them from the pack instead of their files.
+
+const char* const assetPackFilename = "assets.pack";
+
+const vector<string> modelFilenames = {
+    "meshes/terrain.fbx",
+    "meshes/house.fbx",
+    "meshes/house2.fbx",
+    "meshes/plants.fbx",
+    "meshes/delorean.fbx",
+    "meshes/lamp.fbx",
+    "meshes/rock.fbx",
+    "meshes/yuccaTree.fbx",
+    "meshes/sky.fbx",
+};
+
+const vector<string> textureFilenames = {
+    "textures/terrain.tga",
+    "textures/house.tga",
+    "textures/house2.tga",
+    "textures/plants.tga",
+    "textures/delorean.tga",
+    "textures/lamp.tga",
+    "textures/rock.tga",
+    "textures/yuccaTree.tga",
+    "textures/skyDay.tga",
+    "textures/skyNight.tga",
+};
 
 class RenderingApp : public Application
 {
@@ -58,12 +99,17 @@ class RenderingApp : public Application
     const FilterMode defaultFilterMode = FilterMode::Bilinear;
     const float maxFramerate = 30;
     const float minFrameInterval = 1.0f / maxFramerate;
+    const string lightmapDirectory = "lightmaps";
     
     shared_ptr<RenderingContext> context;
+    shared_ptr<AssetPack> assetPack;
+    unique_ptr<AssetLoader> loader; // until every asset has loaded
+    unique_ptr<WorldStreamer> streamer; // the props around the edge of the terrain
     vector<shared_ptr<Texture>> textures;
     shared_ptr<UnlitShader> unlitShader;
     shared_ptr<LitShader> litShader;
     shared_ptr<LitCutoutShader> litCutoutShader;
+    shared_ptr<LitLightmappedShader> litLightmappedShader;
     shared_ptr<Scene> scene;
 
     shared_ptr<Texture> skyDayTex;
@@ -83,6 +129,7 @@ class RenderingApp : public Application
     FilterMode filterMode = defaultFilterMode;
     float speed = 0;
     Vec3 inputDir = Vec3::zero;
+    Vec3 cameraVelocity = Vec3::zero;
     float lastUpdate = 0;
     bool capFramerate = false;
 
@@ -92,48 +139,43 @@ public:
     virtual void OnInitialize() override
     {
         // initialize rendering context
-        size_t threadCount = thread::hardware_concurrency();
-        context = AlignedMakeShared<RenderingContext, 16>(this, screenWidth, screenHeight, threadCount);
+        context = AlignedMakeShared<RenderingContext, 16>(this, screenWidth, screenHeight, JobSystem::shared());
         context->clearColor(Color::clear);
         context->rasterizationMode(RasterizationMode::Halfspace);
         context->mipmapsEnabled(true);
+        context->maxFramesInFlight(2);
+
+        // the demo's textures are only ever replaced, never written to
+        context->incrementalRendering(true);
 
         // create shaders
         unlitShader = AlignedMakeShared<UnlitShader, 16>();
         litShader = AlignedMakeShared<LitShader, 16>();
         litCutoutShader = AlignedMakeShared<LitCutoutShader, 16>();
+        litLightmappedShader = AlignedMakeShared<LitLightmappedShader, 16>();
+
+        // assets missing from the pack, or all of them if there's no pack, are loaded from their files
+        if(GetFileAttributesA(assetPackFilename) != INVALID_FILE_ATTRIBUTES)
+        {
+            try {
+                assetPack = make_shared<AssetPack>(assetPackFilename);
+            }
+            catch(std::exception& ex) {
+                MessageBox(0, ex.what(), "Error loading asset pack", MB_OK | MB_ICONERROR);
+            }
+        }
+
+        // assets load in the background while the scene is drawn with placeholders,
+        // and are put in place between frames as they finish
+        loader = make_unique<AssetLoader>(context->jobSystem(), assetPack);
+        loader->onFailed = [](const string& filename, const string& error) {
+            cout << "Failed to load '" << filename << "': " << error << endl;
+        };
 
-        // load textures
-        auto terrainTex = AlignedMakeShared<Texture, 16>("textures/terrain.tga", filterMode);
-        auto houseTex = AlignedMakeShared<Texture, 16>("textures/house.tga", filterMode);
-        auto house2Tex = AlignedMakeShared<Texture, 16>("textures/house2.tga", filterMode);
-        auto plantsTex = AlignedMakeShared<Texture, 16>("textures/plants.tga", filterMode);
-        auto carTex = AlignedMakeShared<Texture, 16>("textures/delorean.tga", filterMode);
-        auto lampTex = AlignedMakeShared<Texture, 16>("textures/lamp.tga", filterMode);
-        auto rockTex = AlignedMakeShared<Texture, 16>("textures/rock.tga", filterMode);
-        auto yuccaTreeTex = AlignedMakeShared<Texture, 16>("textures/yuccaTree.tga", filterMode);
-        skyDayTex = AlignedMakeShared<Texture, 16>("textures/skyDay.tga", filterMode);
-        skyNightTex = AlignedMakeShared<Texture, 16>("textures/skyNight.tga", filterMode);
-        textures.push_back(terrainTex);
-        textures.push_back(houseTex);
-        textures.push_back(house2Tex);
-        textures.push_back(carTex);
-        textures.push_back(lampTex);
-        textures.push_back(rockTex);
-        textures.push_back(yuccaTreeTex);
-        textures.push_back(skyDayTex);
-        textures.push_back(skyNightTex);
-
-        // load models
-        auto terrainModel = AlignedMakeShared<Model, 16>("meshes/terrain.fbx");
-        auto houseModel = AlignedMakeShared<Model, 16>("meshes/house.fbx");
-        auto house2Model = AlignedMakeShared<Model, 16>("meshes/house2.fbx");
-        auto plantsModel = AlignedMakeShared<Model, 16>("meshes/plants.fbx");
-        auto carModel = AlignedMakeShared<Model, 16>("meshes/delorean.fbx");
-        auto lampModel = AlignedMakeShared<Model, 16>("meshes/lamp.fbx");
-        auto rockModel = AlignedMakeShared<Model, 16>("meshes/rock.fbx");
-        auto yuccaTreeModel = AlignedMakeShared<Model, 16>("meshes/yuccaTree.fbx");
-        auto skyModel = AlignedMakeShared<Model, 16>("meshes/sky.fbx");
+        auto placeholderTex = AssetLoader::PlaceholderTexture();
+        auto placeholderModel = AssetLoader::PlaceholderModel();
+        skyDayTex = placeholderTex;
+        skyNightTex = placeholderTex;
         
         // create camera
         xAngle = 1.0f;
@@ -143,18 +185,23 @@ public:
         cam->transform.SetRotation(xAngle, yAngle, 0.0f);
         
         // create scene objects
-        auto houseObj = AlignedMakeShared<SceneObject, 16>("house", houseModel, houseTex, litShader);
-        auto house2Obj = AlignedMakeShared<SceneObject, 16>("house2", house2Model, house2Tex, litShader);
-        auto plants1Obj = AlignedMakeShared<SceneObject, 16>("plants1", plantsModel, plantsTex, litCutoutShader, CullMode::None);
-        auto plants2Obj = AlignedMakeShared<SceneObject, 16>("plants2", plantsModel, plantsTex, litCutoutShader, CullMode::None);
-        auto plants3Obj = AlignedMakeShared<SceneObject, 16>("plants3", plantsModel, plantsTex, litCutoutShader, CullMode::None);
-        auto carObj = AlignedMakeShared<SceneObject, 16>("car", carModel, carTex, litShader);
-        auto lampObj = AlignedMakeShared<SceneObject, 16>("lamp", lampModel, lampTex, litShader);
-        auto rockObj = AlignedMakeShared<SceneObject, 16>("rock", rockModel, rockTex, litShader);
-        auto yuccaTreeObj1 = AlignedMakeShared<SceneObject, 16>("yucca1", yuccaTreeModel, yuccaTreeTex, litShader, CullMode::None);
-        auto yuccaTreeObj2 = AlignedMakeShared<SceneObject, 16>("yucca2", yuccaTreeModel, yuccaTreeTex, litShader, CullMode::None);
-        auto terrainObj = AlignedMakeShared<SceneObject, 16>("terrain", terrainModel, terrainTex, litShader);
-        auto skyObj = AlignedMakeShared<SceneObject, 16>("sky", skyModel, skyNightTex, unlitShader);
+        auto houseObj = AlignedMakeShared<SceneObject, 16>("house", placeholderModel, placeholderTex, litLightmappedShader);
+        auto house2Obj = AlignedMakeShared<SceneObject, 16>("house2", placeholderModel, placeholderTex, litLightmappedShader);
+        auto carObj = AlignedMakeShared<SceneObject, 16>("car", placeholderModel, placeholderTex, litShader);
+        auto lampObj = AlignedMakeShared<SceneObject, 16>("lamp", placeholderModel, placeholderTex, litLightmappedShader);
+        auto rockObj = AlignedMakeShared<SceneObject, 16>("rock", placeholderModel, placeholderTex, litLightmappedShader);
+        auto terrainObj = AlignedMakeShared<SceneObject, 16>("terrain", placeholderModel, placeholderTex, litLightmappedShader);
+        auto skyObj = AlignedMakeShared<SceneObject, 16>("sky", placeholderModel, placeholderTex, unlitShader);
+        skyObj->castShadows = false;
+
+        // the vegetation is drawn instanced, its instances are placed by the scene settings
+        auto plantsObj = AlignedMakeShared<InstancedObject, 16>("plants", placeholderModel, placeholderTex, litCutoutShader, CullMode::None);
+        auto yuccaTreeObj = AlignedMakeShared<InstancedObject, 16>("yucca", placeholderModel, placeholderTex, litShader, CullMode::None);
+        houseObj->isStatic = true;
+        house2Obj->isStatic = true;
+        lampObj->isStatic = true;
+        rockObj->isStatic = true;
+        terrainObj->isStatic = true;
         
         // create scene lights
         auto ambient = AlignedMakeShared<AmbientLight, 16>("ambient_light", Color32(118, 173, 218, 255), 0.4f);
@@ -162,31 +209,168 @@ public:
         auto lampLight = AlignedMakeShared<PointLight, 16>("lamp_light");
         auto ltHeadlight = AlignedMakeShared<SpotLight, 16>("left_headlight");
         auto rtHeadlight = AlignedMakeShared<SpotLight, 16>("right_headlight");
+        ambient->isStatic = true;
+        lampLight->isStatic = true;
+        direct->castShadows = true;
+        ltHeadlight->castShadows = true;
+        rtHeadlight->castShadows = true;
 
         // assemble scene and apply settings
         scene = AlignedMakeShared<Scene, 16>();
         scene->camera = cam;
         scene->objects.push_back(houseObj);
         scene->objects.push_back(house2Obj);
-        scene->objects.push_back(plants1Obj);
-        scene->objects.push_back(plants2Obj);
-        scene->objects.push_back(plants3Obj);
         scene->objects.push_back(carObj);
         scene->objects.push_back(lampObj);
         scene->objects.push_back(rockObj);
-        scene->objects.push_back(yuccaTreeObj1);
-        scene->objects.push_back(yuccaTreeObj2);
         scene->objects.push_back(terrainObj);
         scene->objects.push_back(skyObj);
+        scene->instancedObjects.push_back(plantsObj);
+        scene->instancedObjects.push_back(yuccaTreeObj);
         scene->lights.push_back(ambient);
         scene->lights.push_back(direct);
         scene->lights.push_back(lampLight);
         scene->lights.push_back(ltHeadlight);
         scene->lights.push_back(rtHeadlight);
         scene->ApplySettings("scene/scene_settings.json");
+
+        // the objects sharing a model or texture get it from the same load
+        auto loadTexture = [&](const char* filename, vector<const char*> objectNames, shared_ptr<Texture>* var = nullptr) {
+            loader->LoadTexture(filename, filterMode, [this, objectNames, var](const shared_ptr<Texture>& tex) {
+                textures.push_back(tex);
+                tex->filterMode(filterMode);
+
+                for(auto name : objectNames)
+                {
+                    if(auto so = scene->FindObject(name))
+                        so->texture = tex;
+                    else
+                        scene->FindInstancedObject(name)->texture = tex;
+                }
+
+                if(var)
+                {
+                    *var = tex;
+                    UpdateSkyTexture();
+                }
+            });
+        };
+
+        auto loadModel = [&](const char* filename, vector<const char*> objectNames) {
+            loader->LoadModel(filename, [this, objectNames](const shared_ptr<Model>& model) {
+                for(auto name : objectNames)
+                {
+                    if(auto so = scene->FindObject(name))
+                        so->model = model;
+                    else
+                        scene->FindInstancedObject(name)->model = model;
+                }
+            });
+        };
+
+        loadTexture("textures/terrain.tga", { "terrain" });
+        loadTexture("textures/house.tga", { "house" });
+        loadTexture("textures/house2.tga", { "house2" });
+        loadTexture("textures/plants.tga", { "plants" });
+        loadTexture("textures/delorean.tga", { "car" });
+        loadTexture("textures/lamp.tga", { "lamp" });
+        loadTexture("textures/rock.tga", { "rock" });
+        loadTexture("textures/yuccaTree.tga", { "yucca" });
+        loadTexture("textures/skyDay.tga", {}, &skyDayTex);
+        loadTexture("textures/skyNight.tga", {}, &skyNightTex);
+
+        loadModel("meshes/terrain.fbx", { "terrain" });
+        loadModel("meshes/house.fbx", { "house" });
+        loadModel("meshes/house2.fbx", { "house2" });
+        loadModel("meshes/plants.fbx", { "plants" });
+        loadModel("meshes/delorean.fbx", { "car" });
+        loadModel("meshes/lamp.fbx", { "lamp" });
+        loadModel("meshes/rock.fbx", { "rock" });
+        loadModel("meshes/yuccaTree.fbx", { "yucca" });
+        loadModel("meshes/sky.fbx", { "sky" });
+
+        // the props around the edge of the terrain are streamed in as the camera gets near them.
+        // the texture budget fits the rocks with either the plants on the west side or the yucca
+        // trees on the east side, so going from one side to the other evicts the ones left behind.
+        streamer = make_unique<WorldStreamer>(scene, context->jobSystem(), assetPack);
+        streamer->cellSize = 8.0f;
+        streamer->loadDistance = 12.0f;
+        streamer->unloadDistance = 16.0f;
+        streamer->lookAhead = 0.5f;
+        streamer->textureBudget = 1792 * 1024;
+        streamer->filterMode = filterMode;
+
+        mt19937 random(1);
+        uniform_real_distribution<float> jitter(-1.5f, 1.5f);
+        uniform_real_distribution<float> angle(0.0f, 360.0f);
+        int propCount = 0;
+
+        for(float x = -27.0f; x <= 27.0f; x += 4.5f)
+        {
+            for(float z = -27.0f; z <= 27.0f; z += 4.5f)
+            {
+                // the middle is where the houses are
+                if(max(abs(x), abs(z)) < 20.0f)
+                    continue;
+
+                WorldStreamer::ObjectDesc desc;
+                desc.name = "prop" + to_string(propCount++);
+                desc.position = Vec3(x + jitter(random), 0.0f, z + jitter(random));
+                desc.rotation = Vec3(0.0f, angle(random), 0.0f);
+
+                if(propCount % 3 == 0)
+                {
+                    desc.model = "meshes/rock.fbx";
+                    desc.texture = "textures/rock.tga";
+                    desc.shader = litShader;
+                }
+                else if(x < 0)
+                {
+                    desc.model = "meshes/plants.fbx";
+                    desc.texture = "textures/plants.tga";
+                    desc.shader = litCutoutShader;
+                    desc.cullMode = CullMode::None;
+                }
+                else
+                {
+                    desc.model = "meshes/yuccaTree.fbx";
+                    desc.texture = "textures/yuccaTree.tga";
+                    desc.shader = litShader;
+                    desc.cullMode = CullMode::None;
+                }
+
+                streamer->AddObject(desc);
+            }
+        }
+    }
+
+    virtual void OnTerminate() override
+    {
+        // the streamer keeps the objects it took out of the scene alive for the frames still drawing them
+        context->Flush();
+        streamer.reset();
+    }
+
+    void UpdateAssets()
+    {
+        if(!loader || !loader->Update())
+            return;
+
+        loader.reset();
+
+        // static objects fall back to per pixel lighting until their lightmaps are baked.
+        // models without lightmap coordinates get them here, so the frames using them have to finish first.
+        context->Flush();
+        LightmapBaker::Load(scene.get(), lightmapDirectory);
+    }
+
+    void UpdateSkyTexture() {
+        scene->FindObject("sky")->texture = litShader->enableLighting?
+            skyNightTex : skyDayTex;
     }
     
     uint32_t lastFps = 0;
+    uint32_t frameAllocations = 0; // heap allocations made while rendering the last frame, see AllocationCount()
 
     virtual bool OnUpdate() override
     {
@@ -204,12 +388,18 @@ public:
             lastUpdate = now;
         }
 
+        UpdateAssets();
         UpdateCamera();
+        streamer->Update(scene->camera->transform.GetPosition(), cameraVelocity);
+
+        uint64_t allocations = AllocationCount();
 
         context->Clear(false, true);
         context->Draw(scene);
         context->Present();
 
+        frameAllocations = (uint32_t)(AllocationCount() - allocations);
+
         Time::update();
 
         auto fps = Time::fps();
@@ -247,8 +437,8 @@ public:
         const char* mipmaps = offOn[context->mipmapsEnabled() ? 1 : 0];
         
         char buff[256];
-        sprintf_s(buff, "%ux%u - Tex Filter: %s - Mipmaps: %s - AA: %s - FPS: %u",
-                  context->width(), context->height(), filtMode, mipmaps, aaMode, lastFps);
+        sprintf_s(buff, "%ux%u - Tex Filter: %s - Mipmaps: %s - AA: %s - FPS: %u - Allocs/Frame: %u",
+                  context->width(), context->height(), filtMode, mipmaps, aaMode, lastFps, frameAllocations);
         return buff;
     }
 
@@ -289,6 +479,7 @@ public:
         Vec3 camPos = scene->camera->transform.GetPosition();
         camPos += velocity * deltaTime;
         scene->camera->transform.SetPosition(camPos);
+        cameraVelocity = velocity;
     }
 
     virtual void OnKeyDown(KeyCode key) override {
@@ -310,20 +501,31 @@ public:
         case KeyCode::L:
             litShader->enableLighting = !litShader->enableLighting;
             litCutoutShader->enableLighting = litShader->enableLighting;
+            litLightmappedShader->enableLighting = litShader->enableLighting;
+            litShader->SettingsChanged();
+            litCutoutShader->SettingsChanged();
+            litLightmappedShader->SettingsChanged();
 
-            scene->FindObject("sky")->texture = litShader->enableLighting?
-                skyNightTex : skyDayTex;
-
+            UpdateSkyTexture();
             break;
 
         case KeyCode::C:
             capFramerate = !capFramerate;
             break;
 
+        case KeyCode::P:
+            context->maxFramesInFlight(context->maxFramesInFlight() > 1 ? 1 : 2);
+            break;
+
         case KeyCode::R:
+            context->Flush();
             scene->ApplySettings("scene/scene_settings.json");
             break;
 
+        case KeyCode::B:
+            BakeLightmaps();
+            break;
+
         case KeyCode::F:
             if(context->antiAliasingMode() == AntiAliasingMode::Off)
                 context->antiAliasingMode(AntiAliasingMode::MSAA_4X);
@@ -409,16 +611,58 @@ public:
         }
     }
 
+    void BakeLightmaps()
+    {
+        // the lightmaps being replaced may still be in use
+        context->Flush();
+
+        // lightmaps are baked for the models, not their placeholders
+        if(loader)
+        {
+            loader->WaitAll();
+            UpdateAssets();
+        }
+
+        try
+        {
+            CreateDirectoryA(lightmapDirectory.c_str(), nullptr);
+
+            LightmapBaker baker(context->jobSystem());
+            baker.Bake(scene.get(), lightmapDirectory);
+        }
+        catch(std::exception& ex) {
+            MessageBox(0, ex.what(), "Error baking lightmaps", MB_OK | MB_ICONERROR);
+        }
+    }
+
     void SetTextureFilters(FilterMode mode)
     {
+        context->Flush();
+
         filterMode = mode;
         for(auto& tex : textures)
             tex->filterMode(mode);
+
+        // the props' textures already loaded keep theirs
+        streamer->filterMode = mode;
     }
 };
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPTSTR lpCmdLine, int nCmdShow)
 {
+    if(strstr(lpCmdLine, "-pack"))
+    {
+        try {
+            JobSystem jobSystem(max(thread::hardware_concurrency(), 1u));
+            AssetPack::Write(assetPackFilename, modelFilenames, textureFilenames, &jobSystem);
+            return 0;
+        }
+        catch(std::exception& ex) {
+            MessageBox(0, ex.what(), "Error writing asset pack", MB_OK | MB_ICONERROR);
+            return 1;
+        }
+    }
+
     RenderingApp app;
     return app.Run();
 }
@@ -2069,6 +2069,21 @@ void Rect::FitInto(const Rect& rc)
     h = (int)sh;
 }
 
+Rect Rect::Union(const Rect& a, const Rect& b)
+{
+    if(a.IsEmpty())
+        return b;
+
+    if(b.IsEmpty())
+        return a;
+
+    int x0 = Math::Min(a.x, b.x);
+    int y0 = Math::Min(a.y, b.y);
+    int x1 = Math::Max(a.x + a.w, b.x + b.w);
+    int y1 = Math::Max(a.y + a.h, b.y + b.h);
+    return Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
 //////////////////////////////////////
 //    ColorBGRA
 //////////////////////////////////////
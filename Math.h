@@ -5,6 +5,7 @@
 
 #pragma once
 #include <cmath>
+#include <cfloat>
 #include <cstdint>
 #include <ostream>
 #include "SIMD.h"
@@ -509,6 +510,17 @@ public:
         : x(x), y(y), w(w), h(h){}
 
     void FitInto(const Rect& rc);
+
+    bool IsEmpty() const {
+        return w <= 0 || h <= 0;
+    }
+
+    bool Intersects(const Rect& rc) const {
+        return x < rc.x + rc.w && rc.x < x + w && y < rc.y + rc.h && rc.y < y + h;
+    }
+
+    // smallest rect containing both, ignoring empty ones
+    static Rect Union(const Rect& a, const Rect& b);
 };
 
 ////////////////////////////////
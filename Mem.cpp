@@ -6,14 +6,26 @@
 #include "Mem.h"
 #include <cstdlib>
 #include <cassert>
+#include <atomic>
+#include <new>
 
-void *AlignedAlloc(size_t size, size_t alignment) {
+static std::atomic<uint64_t> allocationCount(0);
+
+static void* AllocateAligned(size_t size, size_t alignment) {
     void *mem = malloc(sizeof(void*) + (alignment - 1) + size);
+    if(!mem)
+        return nullptr;
+
     void **ptr = (void**)((uintptr_t)((char*)mem + sizeof(void*) + alignment) & ~(alignment - 1));
     ptr[-1] = mem;
     return ptr;
 }
 
+void *AlignedAlloc(size_t size, size_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return AllocateAligned(size, alignment);
+}
+
 void AlignedFree(void* ptr) {
     free(((void**)ptr)[-1]);
 }
@@ -24,3 +36,98 @@ bool IsAligned(const void* ptr, size_t alignment)
     assert((alignment & (alignment - 1)) == 0);
     return (((uintptr_t)ptr) & (alignment - 1)) == 0;
 }
+
+uint64_t AllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+#if COUNT_ALLOCATIONS
+
+// everything allocated with new is counted as well, the standard library's containers included
+
+static void* Allocate(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return malloc(size ? size : 1);
+}
+
+void* operator new(size_t size)
+{
+    void* ptr = Allocate(size);
+    if(!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return Allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return Allocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    free(ptr);
+}
+
+#ifdef __cpp_aligned_new
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    void* ptr = AllocateAligned(size, (size_t)alignment);
+    if(!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    if(ptr)
+        AlignedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    if(ptr)
+        AlignedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+    if(ptr)
+        AlignedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept {
+    if(ptr)
+        AlignedFree(ptr);
+}
+#endif
+
+#endif
@@ -11,6 +11,12 @@ void *AlignedAlloc(size_t size, size_t alignment);
 void AlignedFree(void* ptr);
 bool IsAligned(const void* ptr, size_t alignment);
 
+// number of heap allocations made so far. without COUNT_ALLOCATIONS, only those made through
+// AlignedAlloc(), like arena chunks and aligned vectors, so that hosts keep their own allocator.
+// with it, operator new is replaced and counts everything else too, the standard library's
+// containers included. it's defined by the CMake build and the debug configuration.
+uint64_t AllocationCount();
+
 template<class T, typename... Args>
 T* AlignedAlloc(size_t count, size_t alignment, Args&&... args) {
     T* mem = (T*)AlignedAlloc(count * sizeof(T), alignment);
@@ -0,0 +1,426 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "MeshSimplifier.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace
+{
+    // bitwise copies of the welded attributes, so vertices are welded only if they're identical
+    struct VertexKey
+    {
+        float values[10];
+
+        bool operator==(const VertexKey& other) const {
+            return memcmp(values, other.values, sizeof(values)) == 0;
+        }
+    };
+
+    struct PositionKey
+    {
+        float values[3];
+
+        bool operator==(const PositionKey& other) const {
+            return memcmp(values, other.values, sizeof(values)) == 0;
+        }
+    };
+
+    struct KeyHash
+    {
+        template<class Key>
+        size_t operator()(const Key& key) const
+        {
+            const uint8_t* bytes = (const uint8_t*)key.values;
+            uint64_t hash = 14695981039346656037ull;
+
+            for(size_t i = 0; i < sizeof(key.values); ++i)
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+
+            return (size_t)hash;
+        }
+    };
+
+    // a flipped triangle's normal turns away from where it was facing
+    constexpr double MinNormalDot = 0.2;
+}
+
+MeshSimplifier::Quadric::Quadric()
+    : aa(0), ab(0), ac(0), ad(0), bb(0), bc(0), bd(0), cc(0), cd(0), dd(0){}
+
+MeshSimplifier::Quadric::Quadric(double a, double b, double c, double d, double weight)
+    : aa(a * a * weight), ab(a * b * weight), ac(a * c * weight), ad(a * d * weight),
+      bb(b * b * weight), bc(b * c * weight), bd(b * d * weight),
+      cc(c * c * weight), cd(c * d * weight),
+      dd(d * d * weight){}
+
+MeshSimplifier::Quadric& MeshSimplifier::Quadric::operator+=(const Quadric& q)
+{
+    aa += q.aa; ab += q.ab; ac += q.ac; ad += q.ad;
+    bb += q.bb; bc += q.bc; bd += q.bd;
+    cc += q.cc; cd += q.cd;
+    dd += q.dd;
+    return *this;
+}
+
+double MeshSimplifier::Quadric::Evaluate(const Vec3& p) const
+{
+    double x = p.x, y = p.y, z = p.z;
+    return aa * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x
+         + bb * y * y + 2 * bc * y * z + 2 * bd * y
+         + cc * z * z + 2 * cd * z
+         + dd;
+}
+
+MeshSimplifier::MeshSimplifier(const VertexList& vertices, bool lightmapCoords)
+    : _triangleCount(0)
+{
+    Weld(vertices, lightmapCoords);
+    LockSeamsAndBorders();
+
+    size_t vertCount = _vertices.size();
+    size_t triCount = _indices.size() / 3;
+
+    _quadrics.resize(vertCount);
+    _stamps.resize(vertCount, 0);
+    _collapsed.resize(vertCount, false);
+    _vertexTriangles.resize(vertCount);
+    _removedTriangles.resize(triCount, false);
+    _triangleCount = triCount;
+
+    for(size_t t = 0; t < triCount; ++t)
+    {
+        const uint32_t* tri = &_indices[t * 3];
+        Vec3 p0 = _vertices[tri[0]].position;
+        Vec3 p1 = _vertices[tri[1]].position;
+        Vec3 p2 = _vertices[tri[2]].position;
+
+        // weighted by area, so that small triangles don't pull the surface around
+        Vec3 n = (p1 - p0).Cross(p2 - p0);
+        double length = n.Length();
+        if(length > 0)
+        {
+            double a = n.x / length, b = n.y / length, c = n.z / length;
+            double d = -(a * p0.x + b * p0.y + c * p0.z);
+            Quadric q(a, b, c, d, length * 0.5);
+
+            for(int i = 0; i < 3; ++i)
+                _quadrics[tri[i]] += q;
+        }
+
+        for(int i = 0; i < 3; ++i)
+            _vertexTriangles[tri[i]].push_back((uint32_t)t);
+    }
+
+    // vertices at the same place collapse as one, so they share their quadrics
+    vector<Quadric> positionQuadrics;
+    for(size_t v = 0; v < vertCount; ++v)
+    {
+        if(_positions[v] >= positionQuadrics.size())
+            positionQuadrics.resize(_positions[v] + 1);
+        positionQuadrics[_positions[v]] += _quadrics[v];
+    }
+
+    for(size_t v = 0; v < vertCount; ++v)
+        _quadrics[v] = positionQuadrics[_positions[v]];
+
+    for(size_t t = 0; t < triCount; ++t)
+    {
+        const uint32_t* tri = &_indices[t * 3];
+        for(int i = 0; i < 3; ++i)
+        {
+            uint32_t a = tri[i];
+            uint32_t b = tri[(i + 1) % 3];
+            Push(a, b);
+            Push(b, a);
+        }
+    }
+}
+
+size_t MeshSimplifier::triangleCount() const {
+    return _triangleCount;
+}
+
+void MeshSimplifier::Simplify(size_t targetTriangles)
+{
+    while(_triangleCount > targetTriangles && !_queue.empty())
+    {
+        Collapse collapse = _queue.top();
+        _queue.pop();
+
+        if(_collapsed[collapse.from] || _collapsed[collapse.to]
+        || _stamps[collapse.from] != collapse.fromStamp
+        || _stamps[collapse.to] != collapse.toStamp)
+            continue;
+
+        if(!CanCollapse(collapse.from, collapse.to))
+            continue;
+
+        DoCollapse(collapse.from, collapse.to);
+    }
+}
+
+void MeshSimplifier::GetVertices(VertexList& vertices) const
+{
+    vertices.clear();
+    vertices.reserve(_triangleCount * 3);
+
+    size_t triCount = _indices.size() / 3;
+    for(size_t t = 0; t < triCount; ++t)
+    {
+        if(_removedTriangles[t])
+            continue;
+
+        for(int i = 0; i < 3; ++i)
+            vertices.push_back(_vertices[_indices[t * 3 + i]]);
+    }
+}
+
+void MeshSimplifier::Weld(const VertexList& vertices, bool lightmapCoords)
+{
+    unordered_map<VertexKey, uint32_t, KeyHash> vertexIds;
+    unordered_map<PositionKey, uint32_t, KeyHash> positionIds;
+
+    size_t triCount = vertices.size() / 3;
+    _indices.reserve(triCount * 3);
+
+    for(size_t t = 0; t < triCount; ++t)
+    {
+        uint32_t tri[3];
+        uint32_t pos[3];
+
+        for(int i = 0; i < 3; ++i)
+        {
+            const Vertex& v = vertices[t * 3 + i];
+
+            PositionKey positionKey = {{ v.position.x, v.position.y, v.position.z }};
+            auto posIt = positionIds.emplace(positionKey, (uint32_t)positionIds.size()).first;
+
+            VertexKey key = {{
+                v.position.x, v.position.y, v.position.z,
+                v.normal.x, v.normal.y, v.normal.z,
+                v.texcoord.x, v.texcoord.y,
+                lightmapCoords ? v.lightmapCoord.x : 0.0f,
+                lightmapCoords ? v.lightmapCoord.y : 0.0f
+            }};
+
+            auto result = vertexIds.emplace(key, (uint32_t)_vertices.size());
+            if(result.second)
+            {
+                _vertices.push_back(v);
+                _positions.push_back(posIt->second);
+            }
+
+            tri[i] = result.first->second;
+            pos[i] = posIt->second;
+        }
+
+        // triangles without area have nothing to lose
+        if(pos[0] == pos[1] || pos[1] == pos[2] || pos[2] == pos[0])
+            continue;
+
+        _indices.insert(_indices.end(), tri, tri + 3);
+    }
+}
+
+void MeshSimplifier::LockSeamsAndBorders()
+{
+    size_t vertCount = _vertices.size();
+    _locked.resize(vertCount, false);
+
+    // a position with more than one vertex is on a seam
+    vector<uint32_t> positionUses;
+    for(size_t v = 0; v < vertCount; ++v)
+    {
+        if(_positions[v] >= positionUses.size())
+            positionUses.resize(_positions[v] + 1, 0);
+        ++positionUses[_positions[v]];
+    }
+
+    for(size_t v = 0; v < vertCount; ++v)
+    {
+        if(positionUses[_positions[v]] > 1)
+            _locked[v] = true;
+    }
+
+    // an edge used by only one triangle is on a border, and one used by more than two is non-manifold
+    unordered_map<uint64_t, uint32_t> edgeUses;
+    size_t triCount = _indices.size() / 3;
+
+    for(size_t t = 0; t < triCount; ++t)
+    {
+        for(int i = 0; i < 3; ++i)
+        {
+            uint32_t a = _indices[t * 3 + i];
+            uint32_t b = _indices[t * 3 + (i + 1) % 3];
+            uint64_t edge = ((uint64_t)min(a, b) << 32) | max(a, b);
+            ++edgeUses[edge];
+        }
+    }
+
+    for(auto& edge : edgeUses)
+    {
+        if(edge.second != 2)
+        {
+            _locked[(uint32_t)(edge.first >> 32)] = true;
+            _locked[(uint32_t)edge.first] = true;
+        }
+    }
+}
+
+void MeshSimplifier::Push(uint32_t from, uint32_t to)
+{
+    if(_locked[from])
+        return;
+
+    Collapse collapse;
+    collapse.from = from;
+    collapse.to = to;
+    collapse.fromStamp = _stamps[from];
+    collapse.toStamp = _stamps[to];
+
+    Quadric q = _quadrics[from];
+    q += _quadrics[to];
+    collapse.cost = q.Evaluate(_vertices[to].position);
+
+    _queue.push(collapse);
+}
+
+bool MeshSimplifier::CanCollapse(uint32_t from, uint32_t to) const
+{
+    Vec3 target = _vertices[to].position;
+    uint32_t toPosition = _positions[to];
+
+    // the neighbours 'from' and 'to' have in common, other than the corners of
+    // the triangles that the collapse removes. any more would pinch the surface.
+    size_t removed = 0;
+    vector<uint32_t> fromNeighbours;
+
+    for(uint32_t t : _vertexTriangles[from])
+    {
+        if(_removedTriangles[t])
+            continue;
+
+        const uint32_t* tri = &_indices[t * 3];
+        bool hasTarget = false;
+
+        for(int i = 0; i < 3; ++i)
+        {
+            if(_positions[tri[i]] == toPosition)
+                hasTarget = true;
+            else if(tri[i] != from)
+                fromNeighbours.push_back(_positions[tri[i]]);
+        }
+
+        if(hasTarget)
+        {
+            ++removed;
+            continue;
+        }
+
+        Vec3 p[3];
+        for(int i = 0; i < 3; ++i)
+            p[i] = tri[i] == from ? target : Vec3(_vertices[tri[i]].position);
+
+        Vec3 before = Vec3(_vertices[tri[1]].position - _vertices[tri[0]].position)
+               .Cross(Vec3(_vertices[tri[2]].position - _vertices[tri[0]].position));
+        Vec3 after = (p[1] - p[0]).Cross(p[2] - p[0]);
+
+        double lengths = (double)before.Length() * after.Length();
+        if(lengths <= 0 || before.Dot(after) < MinNormalDot * lengths)
+            return false;
+
+        // small turns can add up over many collapses, so the triangle also has to keep
+        // facing the same way as the normals of its corners. which way that is depends
+        // on the winding, so it's taken from the triangle before the collapse.
+        float facing = 0;
+        for(int i = 0; i < 3; ++i)
+            facing += before.Dot(_vertices[tri[i]].normal);
+
+        for(int i = 0; i < 3; ++i)
+        {
+            const Vertex& corner = _vertices[tri[i] == from ? to : tri[i]];
+            if(after.Dot(corner.normal) * facing <= 0)
+                return false;
+        }
+    }
+
+    size_t shared = 0;
+
+    for(uint32_t t : _vertexTriangles[to])
+    {
+        if(_removedTriangles[t])
+            continue;
+
+        const uint32_t* tri = &_indices[t * 3];
+        for(int i = 0; i < 3; ++i)
+        {
+            if(_positions[tri[i]] != toPosition
+            && find(fromNeighbours.begin(), fromNeighbours.end(), _positions[tri[i]]) != fromNeighbours.end())
+            {
+                // count each common neighbour once
+                uint32_t position = _positions[tri[i]];
+                fromNeighbours.erase(remove(fromNeighbours.begin(), fromNeighbours.end(), position), fromNeighbours.end());
+                ++shared;
+            }
+        }
+    }
+
+    return removed > 0 && shared <= 2;
+}
+
+void MeshSimplifier::DoCollapse(uint32_t from, uint32_t to)
+{
+    uint32_t toPosition = _positions[to];
+    vector<uint32_t>& toTriangles = _vertexTriangles[to];
+
+    for(uint32_t t : _vertexTriangles[from])
+    {
+        if(_removedTriangles[t])
+            continue;
+
+        uint32_t* tri = &_indices[t * 3];
+
+        if(_positions[tri[0]] == toPosition || _positions[tri[1]] == toPosition || _positions[tri[2]] == toPosition)
+        {
+            _removedTriangles[t] = true;
+            --_triangleCount;
+            continue;
+        }
+
+        for(int i = 0; i < 3; ++i)
+        {
+            if(tri[i] == from)
+                tri[i] = to;
+        }
+
+        toTriangles.push_back(t);
+    }
+
+    _collapsed[from] = true;
+    _vertexTriangles[from].clear();
+    _vertexTriangles[from].shrink_to_fit();
+
+    toTriangles.erase(remove_if(toTriangles.begin(), toTriangles.end(),
+        [this](uint32_t t){ return _removedTriangles[t]; }), toTriangles.end());
+
+    _quadrics[to] += _quadrics[from];
+    ++_stamps[to];
+
+    for(uint32_t t : toTriangles)
+    {
+        const uint32_t* tri = &_indices[t * 3];
+        for(int i = 0; i < 3; ++i)
+        {
+            if(tri[i] != to)
+            {
+                Push(to, tri[i]);
+                Push(tri[i], to);
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <queue>
+#include <vector>
+#include "Mem.h"
+#include "Vertex.h"
+using namespace std;
+
+// Simplifies a triangle list with quadric error metrics (Garland & Heckbert), collapsing
+// vertices into one of their neighbours, cheapest first.
+//
+// Collapsed vertices are replaced by the neighbour as it is, so the remaining vertices keep
+// their normals and uvs. Vertices on uv or normal seams and on open borders never move,
+// which keeps the seams and the outlines of open surfaces where they are.
+class MeshSimplifier
+{
+public:
+    typedef vector<Vertex, AlignedAllocator<Vertex, 16>> VertexList;
+
+    // the vertices are welded by position, normal and uvs. lightmap
+    // coordinates are left out unless 'lightmapCoords' is true.
+    MeshSimplifier(const VertexList& vertices, bool lightmapCoords);
+
+    size_t triangleCount() const;
+
+    // collapses vertices until no more than 'targetTriangles' are left, or nothing else
+    // can be collapsed. can be called again with a lower target to carry on from there.
+    void Simplify(size_t targetTriangles);
+
+    // the triangles left, as a triangle list
+    void GetVertices(VertexList& vertices) const;
+
+private:
+    // symmetric 4x4 matrix summing the squared distances to a set of planes
+    struct Quadric
+    {
+        double aa, ab, ac, ad, bb, bc, bd, cc, cd, dd;
+
+        Quadric();
+        Quadric(double a, double b, double c, double d, double weight);
+        Quadric& operator+=(const Quadric& q);
+        double Evaluate(const Vec3& p) const;
+    };
+
+    struct Collapse
+    {
+        double cost;
+        uint32_t from;
+        uint32_t to;
+        uint32_t fromStamp; // the collapse is stale once either vertex changes
+        uint32_t toStamp;
+
+        bool operator>(const Collapse& other) const {
+            return cost > other.cost;
+        }
+    };
+
+    void Weld(const VertexList& vertices, bool lightmapCoords);
+    void LockSeamsAndBorders();
+    void Push(uint32_t from, uint32_t to);
+    bool CanCollapse(uint32_t from, uint32_t to) const;
+    void DoCollapse(uint32_t from, uint32_t to);
+
+    VertexList _vertices;            // welded
+    vector<uint32_t> _positions;     // id of each vertex's position, shared by vertices at the same place
+    vector<uint32_t> _indices;       // 3 per triangle
+    vector<bool> _removedTriangles;
+    vector<vector<uint32_t>> _vertexTriangles;
+    vector<Quadric> _quadrics;
+    vector<uint32_t> _stamps;
+    vector<bool> _locked;
+    vector<bool> _collapsed;
+    priority_queue<Collapse, vector<Collapse>, greater<Collapse>> _queue;
+    size_t _triangleCount;
+};
@@ -4,149 +4,979 @@
 *--------------------------------------------------------------------------------------------*/
 
 #include "Model.h"
+#include "JobSystem.h"
+#include "MeshSimplifier.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
 
-Model::Model(const string &filename)
-{
-    LoadFromFBXFile(filename);
-}
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/stat.h>
+#endif
 
-Model::~Model()
+namespace
 {
-    
-}
+    const uint32_t LODFileMagic = 0x53444F4C; // "LODS"
+    const uint32_t LODFileVersion = 1;
 
-void Model::LoadFromFBXFile(const string &filename)
-{
-    FbxManager *sdkManager = NULL;
-    FbxImporter* importer = NULL;
-    FbxScene* scene = NULL;
+    // FBX files are in centimeters with y and z swapped
+    Vec3 FromFbxVector(const double* v) {
+        return Vec3((float)v[0] * 0.01f, (float)v[2] * 0.01f, (float)v[1] * 0.01f);
+    }
 
-    try
+    Vec2 FromFbxUV(const double* v) {
+        return Vec2((float)v[0], 1.0f - (float)v[1]);
+    }
+
+    // the normals, uvs or other per vertex data of a mesh
+    class LayerElement
     {
-        sdkManager = FbxManager::Create();
-        sdkManager->SetIOSettings( FbxIOSettings::Create(sdkManager, IOSROOT) );
-        importer = FbxImporter::Create(sdkManager, "");
+    public:
+        LayerElement() : _mapping(Mapping::None), _components(0) {}
 
-        if(!importer->Initialize(filename.c_str(), -1, sdkManager->GetIOSettings()))
-            throw "Failed to initialize the FBX importer";
-        
-        scene = FbxScene::Create(sdkManager, "scene");
-        bool didImport = importer->Import(scene);
-        
-        if(!importer->Import(scene))
-            throw "Failed to import the FBX scene";
+        // reads the element's values from its 'valuesName' child, and their indices from 'indicesName'
+        void Load(const FbxFile::Node& element, const char* valuesName, const char* indicesName, int components)
+        {
+            const FbxFile::Node* mapping = element.Find("MappingInformationType");
+            const FbxFile::Node* reference = element.Find("ReferenceInformationType");
+            const FbxFile::Node* values = element.Find(valuesName);
+            const FbxFile::Node* indices = element.Find(indicesName);
+
+            if(!mapping || !reference || !values || mapping->properties.empty()
+            || reference->properties.empty() || values->properties.empty())
+                return;
+
+            string mappingType = mapping->properties[0].AsString();
 
-        FbxNode* rootNode = scene->GetRootNode();
+            if(mappingType == "ByPolygonVertex")
+                _mapping = Mapping::ByPolygonVertex;
+            else if(mappingType == "ByVertice" || mappingType == "ByVertex" || mappingType == "ByControlPoint")
+                _mapping = Mapping::ByControlPoint;
+            else if(mappingType == "ByPolygon")
+                _mapping = Mapping::ByPolygon;
+            else if(mappingType == "AllSame")
+                _mapping = Mapping::AllSame;
+            else
+                return;
 
-        bool foundMesh = false;
-        int nChildren = rootNode->GetChildCount();
+            values->properties[0].GetArray(_values);
+            _components = components;
 
-        for(int i = 0; i < nChildren; i++)
+            string referenceType = reference->properties[0].AsString();
+
+            if(referenceType == "IndexToDirect" || referenceType == "Index")
+            {
+                if(!indices || indices->properties.empty())
+                    _mapping = Mapping::None;
+                else
+                    indices->properties[0].GetArray(_indices);
+            }
+        }
+
+        // the value of a polygon's corner, false if there isn't one
+        bool Get(size_t polygonVertex, size_t controlPoint, size_t polygon, double* value) const
         {
-            if(LoadFirstMeshNode_R(sdkManager, rootNode->GetChild(i)))
+            size_t i;
+
+            switch(_mapping)
             {
-                foundMesh = true;
-                break;
+            case Mapping::ByPolygonVertex: i = polygonVertex; break;
+            case Mapping::ByControlPoint:  i = controlPoint; break;
+            case Mapping::ByPolygon:       i = polygon; break;
+            case Mapping::AllSame:         i = 0; break;
+            default:                       return false;
             }
+
+            if(!_indices.empty())
+            {
+                if(i >= _indices.size() || _indices[i] < 0)
+                    return false;
+
+                i = (size_t)_indices[i];
+            }
+
+            if((i + 1) * _components > _values.size())
+                return false;
+
+            for(int c = 0; c < _components; ++c)
+                value[c] = _values[i * _components + c];
+
+            return true;
         }
 
-        if(!foundMesh)
-            throw "Mesh node not found.";
+    private:
+        enum class Mapping
+        {
+            None,
+            ByPolygonVertex,
+            ByControlPoint,
+            ByPolygon,
+            AllSame,
+        };
+
+        Mapping _mapping;
+        int _components;
+        vector<double> _values;
+        vector<int32_t> _indices;
+    };
+
+    struct FbxQuat
+    {
+        double x, y, z, w;
+
+        FbxQuat operator*(const FbxQuat& q) const
+        {
+            return {
+                w * q.x + x * q.w + y * q.z - z * q.y,
+                w * q.y - x * q.z + y * q.w + z * q.x,
+                w * q.z + x * q.y - y * q.x + z * q.w,
+                w * q.w - x * q.x - y * q.y - z * q.z
+            };
+        }
+
+        void Rotate(double* v) const
+        {
+            // v + 2w(q x v) + 2q x (q x v)
+            double tx = 2 * (y * v[2] - z * v[1]);
+            double ty = 2 * (z * v[0] - x * v[2]);
+            double tz = 2 * (x * v[1] - y * v[0]);
+
+            double rx = v[0] + w * tx + (y * tz - z * ty);
+            double ry = v[1] + w * ty + (z * tx - x * tz);
+            double rz = v[2] + w * tz + (x * ty - y * tx);
+
+            v[0] = rx;
+            v[1] = ry;
+            v[2] = rz;
+        }
+
+        // euler angles in degrees, applied x first, then y, then z
+        static FbxQuat FromEuler(const double* angles)
+        {
+            const double HalfRadians = 3.14159265358979323846 / 360.0;
+
+            double x = angles[0] * HalfRadians;
+            double y = angles[1] * HalfRadians;
+            double z = angles[2] * HalfRadians;
+
+            FbxQuat qx = { sin(x), 0, 0, cos(x) };
+            FbxQuat qy = { 0, sin(y), 0, cos(y) };
+            FbxQuat qz = { 0, 0, sin(z), cos(z) };
+
+            return qz * qy * qx;
+        }
+    };
+
+    // translation, rotation and scale of a model, relative to its parent. pivots and offsets aren't applied.
+    struct FbxTransform
+    {
+        double translation[3] = { 0, 0, 0 };
+        FbxQuat rotation = { 0, 0, 0, 1 };
+        double scale[3] = { 1, 1, 1 };
+
+        // what 'rotation' is made of, for animation curves to replace the angles
+        double rotationAngles[3] = { 0, 0, 0 };
+        FbxQuat preRotation = { 0, 0, 0, 1 };
+
+        explicit FbxTransform(const FbxFile::Node& model)
+        {
+            double preRotationAngles[3] = { 0, 0, 0 };
+            bool rotationActive = false;
+
+            const FbxFile::Node* properties = model.Find("Properties70");
+
+            for(size_t i = 0; properties && i < properties->children.size(); ++i)
+            {
+                auto& p = properties->children[i].properties;
+                if(p.size() < 5)
+                    continue;
+
+                string name = p[0].AsString();
+                double* value = nullptr;
+
+                if(name == "Lcl Translation")
+                    value = translation;
+                else if(name == "Lcl Rotation")
+                    value = rotationAngles;
+                else if(name == "Lcl Scaling")
+                    value = scale;
+                else if(name == "PreRotation")
+                    value = preRotationAngles;
+                else if(name == "RotationActive")
+                    rotationActive = p[4].AsInt() != 0;
 
-        RecalcBounds();
+                for(size_t c = 0; value && c < 3 && 4 + c < p.size(); ++c)
+                    value[c] = p[4 + c].AsDouble();
+            }
+
+            if(rotationActive)
+                preRotation = FbxQuat::FromEuler(preRotationAngles);
+
+            SetRotationAngles(rotationAngles);
+        }
+
+        void SetRotationAngles(const double* angles)
+        {
+            for(int c = 0; c < 3; ++c)
+                rotationAngles[c] = angles[c];
+
+            rotation = preRotation * FbxQuat::FromEuler(rotationAngles);
+        }
+
+        // 'parent' applied after this one, ignoring the shear non uniform scales would add
+        void Append(const FbxTransform& parent)
+        {
+            for(int c = 0; c < 3; ++c)
+                translation[c] *= parent.scale[c];
+
+            parent.rotation.Rotate(translation);
+
+            for(int c = 0; c < 3; ++c)
+            {
+                translation[c] += parent.translation[c];
+                scale[c] *= parent.scale[c];
+            }
+
+            rotation = parent.rotation * rotation;
+        }
+    };
+
+    const double FbxTicksPerSecond = 46186158000.0;
+
+    // the name of an object without its class, like "Bone" out of "Bone\0\x01Model"
+    string GetObjectName(const FbxFile::Node& object)
+    {
+        if(object.properties.size() < 2)
+            return string();
+
+        string name = object.properties[1].AsString();
+        return name.substr(0, name.find('\0'));
     }
-    catch(const char *exception)
+
+    bool IsObject(const FbxFile::Node& object, const char* nodeName, const char* className)
     {
-        cout << "Failed to load FBX file: " << exception << endl;
+        return object.name == nodeName && object.properties.size() >= 3 && object.properties[2].AsString() == className;
     }
 
-    if(importer)    importer->Destroy();
-    if(scene)       scene->Destroy();
-    if(sdkManager)  sdkManager->Destroy();
-}
+    // the objects of a file, and how they're connected to each other
+    class FbxScene
+    {
+    public:
+        const FbxFile::Node* objects;
 
-bool Model::LoadFirstMeshNode_R(FbxManager *sdkManager, FbxNode *pNode)
-{
-    for(int a = 0; a < pNode->GetNodeAttributeCount(); a++)
+        explicit FbxScene(const FbxFile& file)
+        {
+            objects = file.root().Find("Objects");
+            const FbxFile::Node* connections = file.root().Find("Connections");
+
+            if(!objects || !connections)
+                throw runtime_error("Objects or connections not found.");
+
+            for(auto& object : objects->children)
+            {
+                if(!object.properties.empty())
+                    _objectsByID[object.properties[0].AsInt()] = &object;
+            }
+
+            // objects to objects, or to one of their properties, like an animation curve to a bone's rotation
+            for(auto& connection : connections->children)
+            {
+                auto& p = connection.properties;
+                if(connection.name != "C" || p.size() < 3)
+                    continue;
+
+                string type = p[0].AsString();
+                if(type != "OO" && type != "OP")
+                    continue;
+
+                string property = type == "OP" && p.size() >= 4 ? p[3].AsString() : string();
+                _parents.emplace(p[1].AsInt(), Connection{ p[2].AsInt(), property });
+                _children.emplace(p[2].AsInt(), Connection{ p[1].AsInt(), property });
+            }
+        }
+
+        const FbxFile::Node* Find(int64_t id) const
+        {
+            auto object = _objectsByID.find(id);
+            return object != _objectsByID.end() ? object->second : nullptr;
+        }
+
+        // models are the nodes of the scene, and hold on to geometry, materials and other models
+        const FbxFile::Node* FindParentModel(int64_t id) const
+        {
+            auto range = _parents.equal_range(id);
+
+            for(auto it = range.first; it != range.second; ++it)
+            {
+                const FbxFile::Node* parent = Find(it->second.id);
+                if(parent && parent->name == "Model")
+                    return parent;
+            }
+
+            return nullptr;
+        }
+
+        // the objects called 'nodeName' connected to 'id', or to its 'property' if there is one
+        vector<const FbxFile::Node*> FindChildren(int64_t id, const char* nodeName, const char* property = nullptr) const
+        {
+            vector<const FbxFile::Node*> found;
+            auto range = _children.equal_range(id);
+
+            for(auto it = range.first; it != range.second; ++it)
+            {
+                const FbxFile::Node* child = Find(it->second.id);
+                if(child && child->name == nodeName && (!property || it->second.property == property))
+                    found.push_back(child);
+            }
+
+            // connections are kept in a hash table, the file's order is kept for whoever takes the first
+            sort(found.begin(), found.end());
+            return found;
+        }
+
+        FbxTransform GetGlobalTransform(const FbxFile::Node& model) const
+        {
+            FbxTransform globalTransform(model);
+
+            // a damaged file could connect models in a loop
+            const FbxFile::Node* parent = FindParentModel(model.properties[0].AsInt());
+
+            for(size_t depth = 0; parent && depth < _objectsByID.size(); ++depth)
+            {
+                globalTransform.Append(FbxTransform(*parent));
+                parent = FindParentModel(parent->properties[0].AsInt());
+            }
+
+            return globalTransform;
+        }
+
+    private:
+        struct Connection
+        {
+            int64_t id;
+            string property;
+        };
+
+        unordered_map<int64_t, const FbxFile::Node*> _objectsByID;
+        unordered_multimap<int64_t, Connection> _parents;
+        unordered_multimap<int64_t, Connection> _children;
+    };
+
+    // the keys of one component of an animated property, interpolated linearly. tangents aren't read.
+    class FbxCurve
     {
-        FbxNodeAttribute *attrib = pNode->GetNodeAttributeByIndex(a);
-        FbxNodeAttribute::EType type = attrib->GetAttributeType();
+    public:
+        explicit FbxCurve(const FbxFile::Node& curve)
+        {
+            const FbxFile::Node* times = curve.Find("KeyTime");
+            const FbxFile::Node* values = curve.Find("KeyValueFloat");
 
-        if(type == FbxNodeAttribute::eMesh)
+            if(times && values && !times->properties.empty() && !values->properties.empty())
+            {
+                times->properties[0].GetArray(_times);
+                values->properties[0].GetArray(_values);
+            }
+
+            _times.resize(min(_times.size(), _values.size()));
+
+            for(auto& time : _times)
+                time /= FbxTicksPerSecond;
+        }
+
+        bool empty() const {
+            return _times.empty();
+        }
+
+        double duration() const {
+            return _times.empty() ? 0.0 : _times.back();
+        }
+
+        double Evaluate(double time) const
         {
-            FbxAMatrix globalTransform = pNode->EvaluateGlobalTransform();
-            
-            defaultTransfrom.SetPosition( FromFbxType(globalTransform.GetT()) );
-            defaultTransfrom.SetScale( FromFbxType(globalTransform.GetS()) );
-            defaultTransfrom.SetRotation( FromFbxType(globalTransform.GetQ()) );
+            auto next = upper_bound(_times.begin(), _times.end(), time);
+            if(next == _times.begin())
+                return _values.front();
 
-            LoadMeshData((FbxMesh*)attrib);
+            if(next == _times.end())
+                return _values[_times.size() - 1];
 
-            return true;
+            size_t i = next - _times.begin();
+            double t = (time - _times[i - 1]) / (_times[i] - _times[i - 1]);
+            return _values[i - 1] + (_values[i] - _values[i - 1]) * t;
+        }
+
+    private:
+        vector<double> _times; // seconds
+        vector<double> _values;
+    };
+
+    // a bone's translation, rotation or scale through an animation, or null curves where it stays put
+    struct FbxCurveNode
+    {
+        shared_ptr<FbxCurve> curves[3];
+
+        void Evaluate(double time, double* value) const
+        {
+            for(int c = 0; c < 3; ++c)
+            {
+                if(curves[c])
+                    value[c] = curves[c]->Evaluate(time);
+            }
         }
+    };
+
+    Mat4 FromFbxMatrix(const double* m)
+    {
+        // column major for column vectors is row major for row vectors
+        return Mat4((float)m[0],  (float)m[1],  (float)m[2],  (float)m[3],
+                    (float)m[4],  (float)m[5],  (float)m[6],  (float)m[7],
+                    (float)m[8],  (float)m[9],  (float)m[10], (float)m[11],
+                    (float)m[12], (float)m[13], (float)m[14], (float)m[15]);
     }
 
-    int nChildren = pNode->GetChildCount();
+    BonePose FromFbxTransform(const FbxTransform& transform)
+    {
+        BonePose pose;
+
+        for(int c = 0; c < 3; ++c)
+        {
+            pose.translation[c] = (float)transform.translation[c];
+            pose.scale[c] = (float)transform.scale[c];
+        }
 
-    for(int i = 0; i < nChildren; i++)
+        pose.rotation[0] = (float)transform.rotation.x;
+        pose.rotation[1] = (float)transform.rotation.y;
+        pose.rotation[2] = (float)transform.rotation.z;
+        pose.rotation[3] = (float)transform.rotation.w;
+        return pose;
+    }
+
+    bool SamePose(const BonePose& a, const BonePose& b)
     {
-        if(LoadFirstMeshNode_R(sdkManager, pNode->GetChild(i)))
-            return true;
+        const float* fa = a.translation;
+        const float* fb = b.translation;
+
+        for(size_t i = 0; i < sizeof(BonePose) / sizeof(float); ++i)
+        {
+            if(fabs(fa[i] - fb[i]) > 1e-6f)
+                return false;
+        }
+
+        return true;
+    }
+
+    // samples the bones' curves in each of the file's animation stacks, the first layer of each
+    void LoadAnimations(const FbxScene& scene, const vector<const FbxFile::Node*>& bones, vector<AnimationClip>& animations)
+    {
+        const char* properties[3] = { "Lcl Translation", "Lcl Rotation", "Lcl Scaling" };
+        const char* components[3] = { "d|X", "d|Y", "d|Z" };
+
+        for(auto& stack : scene.objects->children)
+        {
+            if(stack.name != "AnimationStack" || stack.properties.empty())
+                continue;
+
+            auto layers = scene.FindChildren(stack.properties[0].AsInt(), "AnimationLayer");
+            if(layers.empty())
+                continue;
+
+            auto layerNodes = scene.FindChildren(layers[0]->properties[0].AsInt(), "AnimationCurveNode");
+
+            // by bone, then translation, rotation and scale
+            vector<FbxCurveNode> curveNodes(bones.size() * 3);
+            double duration = 0;
+            bool animated = false;
+
+            for(size_t b = 0; b < bones.size(); ++b)
+            {
+                for(int p = 0; p < 3; ++p)
+                {
+                    for(const FbxFile::Node* node : scene.FindChildren(bones[b]->properties[0].AsInt(), "AnimationCurveNode", properties[p]))
+                    {
+                        if(!binary_search(layerNodes.begin(), layerNodes.end(), node))
+                            continue;
+
+                        for(int c = 0; c < 3; ++c)
+                        {
+                            auto curves = scene.FindChildren(node->properties[0].AsInt(), "AnimationCurve", components[c]);
+                            if(curves.empty())
+                                continue;
+
+                            auto curve = make_shared<FbxCurve>(*curves[0]);
+                            if(curve->empty())
+                                continue;
+
+                            duration = max(duration, curve->duration());
+                            curveNodes[b * 3 + p].curves[c] = curve;
+                            animated = true;
+                        }
+                    }
+                }
+            }
+
+            if(!animated)
+                continue;
+
+            AnimationClip clip;
+            clip.name = GetObjectName(stack);
+            clip.frameCount = (int)floor(duration * clip.frameRate + 0.5) + 1;
+            clip.tracks.resize(bones.size());
+
+            vector<BonePose> track(clip.frameCount);
+
+            for(size_t b = 0; b < bones.size(); ++b)
+            {
+                FbxTransform transform(*bones[b]);
+
+                for(int f = 0; f < clip.frameCount; ++f)
+                {
+                    double time = f / (double)clip.frameRate;
+                    double angles[3] = { transform.rotationAngles[0], transform.rotationAngles[1], transform.rotationAngles[2] };
+
+                    curveNodes[b * 3].Evaluate(time, transform.translation);
+                    curveNodes[b * 3 + 1].Evaluate(time, angles);
+                    curveNodes[b * 3 + 2].Evaluate(time, transform.scale);
+                    transform.SetRotationAngles(angles);
+
+                    track[f] = FromFbxTransform(transform);
+
+                    // the keys are blended the short way around, which has to be the way the curves go
+                    if(f > 0)
+                    {
+                        float dot = 0;
+                        for(int c = 0; c < 4; ++c)
+                            dot += track[f].rotation[c] * track[f - 1].rotation[c];
+
+                        for(int c = 0; dot < 0 && c < 4; ++c)
+                            track[f].rotation[c] = -track[f].rotation[c];
+                    }
+                }
+
+                bool still = all_of(track.begin(), track.end(), [&](const BonePose& pose) {
+                    return SamePose(pose, track[0]);
+                });
+
+                size_t keyCount = still ? 1 : track.size();
+                clip.tracks[b] = AnimationClip::Track{ (uint32_t)clip.keys.size(), (uint32_t)keyCount };
+                clip.keys.insert(clip.keys.end(), track.begin(), track.begin() + keyCount);
+            }
+
+            animations.push_back(move(clip));
+        }
     }
 
-    return false;
+    // reads the bones a mesh is bound to through a skin deformer, and their animations.
+    // returns false if the mesh isn't skinned.
+    bool LoadSkin(const FbxScene& scene, const FbxFile::Node& geometry, const vector<uint32_t>& vertexControlPoints,
+                  size_t controlPointCount, Skeleton& skeleton, vector<SkinWeights>& skinWeights, vector<AnimationClip>& animations)
+    {
+        const FbxFile::Node* skin = nullptr;
+
+        for(const FbxFile::Node* deformer : scene.FindChildren(geometry.properties[0].AsInt(), "Deformer"))
+        {
+            if(IsObject(*deformer, "Deformer", "Skin"))
+            {
+                skin = deformer;
+                break;
+            }
+        }
+
+        if(!skin)
+            return false;
+
+        struct Cluster
+        {
+            const FbxFile::Node* bone;
+            vector<int32_t> indices;
+            vector<double> weights;
+            vector<double> transform;     // the mesh's global transform when it was bound
+            vector<double> transformLink; // the bone's
+        };
+
+        vector<Cluster> clusters;
+
+        for(const FbxFile::Node* deformer : scene.FindChildren(skin->properties[0].AsInt(), "Deformer"))
+        {
+            if(!IsObject(*deformer, "Deformer", "Cluster"))
+                continue;
+
+            auto boneModels = scene.FindChildren(deformer->properties[0].AsInt(), "Model");
+            const FbxFile::Node* indices = deformer->Find("Indexes");
+            const FbxFile::Node* weights = deformer->Find("Weights");
+            const FbxFile::Node* transform = deformer->Find("Transform");
+            const FbxFile::Node* transformLink = deformer->Find("TransformLink");
+
+            if(boneModels.empty() || !transform || !transformLink || transform->properties.empty() || transformLink->properties.empty())
+                continue;
+
+            Cluster cluster;
+            cluster.bone = boneModels[0];
+
+            if(indices && weights && !indices->properties.empty() && !weights->properties.empty())
+            {
+                indices->properties[0].GetArray(cluster.indices);
+                weights->properties[0].GetArray(cluster.weights);
+            }
+
+            transform->properties[0].GetArray(cluster.transform);
+            transformLink->properties[0].GetArray(cluster.transformLink);
+
+            if(cluster.transform.size() != 16 || cluster.transformLink.size() != 16)
+                throw runtime_error("Skin cluster has an invalid transform.");
+
+            clusters.push_back(move(cluster));
+        }
+
+        if(clusters.empty())
+            return false;
+
+        // the bones, and every model above them, parents first
+        vector<const FbxFile::Node*> bones;
+        unordered_map<const FbxFile::Node*, int> depths;
+
+        for(auto& cluster : clusters)
+        {
+            vector<const FbxFile::Node*> chain;
+
+            for(const FbxFile::Node* model = cluster.bone; model && !depths.count(model) && chain.size() <= scene.objects->children.size();
+                model = scene.FindParentModel(model->properties[0].AsInt()))
+                chain.push_back(model);
+
+            for(const FbxFile::Node* model : chain)
+            {
+                depths[model] = 0;
+                bones.push_back(model);
+            }
+        }
+
+        for(const FbxFile::Node* bone : bones)
+        {
+            int depth = 0;
+            for(const FbxFile::Node* parent = scene.FindParentModel(bone->properties[0].AsInt()); parent && depth <= (int)bones.size();
+                parent = scene.FindParentModel(parent->properties[0].AsInt()))
+                ++depth;
+
+            depths[bone] = depth;
+        }
+
+        stable_sort(bones.begin(), bones.end(), [&](const FbxFile::Node* a, const FbxFile::Node* b) {
+            return depths[a] < depths[b];
+        });
+
+        // one more for the vertices that don't follow any bone
+        if(bones.size() >= 0xFFFF)
+            throw runtime_error("Skin has too many bones.");
+
+        unordered_map<const FbxFile::Node*, int> boneIndices;
+        for(size_t b = 0; b < bones.size(); ++b)
+            boneIndices[bones[b]] = (int)b;
+
+        // the bones work in the file's space, and the vertices were brought into the model's.
+        // for row vectors, model = file * toModel, with y and z swapped and centimeters made meters.
+        const Mat4 toModel(0.01f, 0, 0, 0, 0, 0, 0.01f, 0, 0, 0.01f, 0, 0, 0, 0, 0, 1);
+        const Mat4 toFile(100.0f, 0, 0, 0, 0, 0, 100.0f, 0, 0, 100.0f, 0, 0, 0, 0, 0, 1);
+
+        skeleton.bones.resize(bones.size());
+
+        for(size_t b = 0; b < bones.size(); ++b)
+        {
+            Skeleton::Bone& bone = skeleton.bones[b];
+            const FbxFile::Node* parent = scene.FindParentModel(bones[b]->properties[0].AsInt());
+            auto parentIndex = parent ? boneIndices.find(parent) : boneIndices.end();
+
+            bone.name = GetObjectName(*bones[b]);
+            bone.parent = parentIndex != boneIndices.end() ? parentIndex->second : -1;
+            bone.bindPose = FromFbxTransform(FbxTransform(*bones[b]));
+            bone.offset = Mat4::identity;
+        }
+
+        // a vertex moves with a bone as it was when it was bound. the weights
+        // of each control point are gathered, and its 4 heaviest bones kept.
+        vector<vector<pair<float, uint16_t>>> influences(controlPointCount);
+
+        for(auto& cluster : clusters)
+        {
+            int b = boneIndices[cluster.bone];
+            Mat4 meshBind = FromFbxMatrix(cluster.transform.data());
+
+            skeleton.bones[b].offset = toFile * meshBind * FromFbxMatrix(cluster.transformLink.data()).Inverse();
+            skeleton.meshTransform = meshBind.Inverse() * toModel;
+
+            size_t count = min(cluster.indices.size(), cluster.weights.size());
+
+            for(size_t i = 0; i < count; ++i)
+            {
+                int32_t controlPoint = cluster.indices[i];
+                if(controlPoint >= 0 && (size_t)controlPoint < controlPointCount && cluster.weights[i] > 0)
+                    influences[controlPoint].emplace_back((float)cluster.weights[i], (uint16_t)b);
+            }
+        }
+
+        vector<SkinWeights> controlPointWeights(controlPointCount);
+        uint16_t unbound = (uint16_t)bones.size();
+
+        for(size_t cp = 0; cp < controlPointCount; ++cp)
+        {
+            auto& cpInfluences = influences[cp];
+            sort(cpInfluences.begin(), cpInfluences.end(), greater<pair<float, uint16_t>>());
+
+            size_t count = min(cpInfluences.size(), (size_t)4);
+            float total = 0;
+            for(size_t i = 0; i < count; ++i)
+                total += cpInfluences[i].first;
+
+            SkinWeights& weights = controlPointWeights[cp];
+
+            for(size_t i = 0; i < 4; ++i)
+            {
+                weights.weights[i] = i < count ? cpInfluences[i].first / total : 0.0f;
+                weights.bones[i] = i < count ? cpInfluences[i].second : unbound;
+            }
+
+            if(count == 0)
+                weights.weights[0] = 1.0f;
+        }
+
+        skinWeights.resize(vertexControlPoints.size());
+        for(size_t v = 0; v < vertexControlPoints.size(); ++v)
+            skinWeights[v] = controlPointWeights[vertexControlPoints[v]];
+
+        LoadAnimations(scene, bones, animations);
+        return true;
+    }
 }
 
-void Model::LoadMeshData(FbxMesh *fbxMesh)
+Model::Model(const string &filename, JobSystem* jobSystem)
 {
-    FbxVector4 *fbxVertices = fbxMesh->GetControlPoints();
-    int triCount = fbxMesh->GetPolygonCount();
-    int fbxVertCount = fbxMesh->GetControlPointsCount();
+    LoadFromFBXFile(filename, jobSystem);
 
-    vertices.reserve(triCount * 3);
+    // a skinned model's vertices move every frame, and are drawn in full
+    if(skinned())
+        return;
+
+    // simplifying takes a while, so the LODs are only generated again when the model changes
+    string lodFilename = GetLODFilename(filename);
+    if(!vertices.empty() && !LoadLODs(lodFilename))
+    {
+        GenerateLODs();
+        SaveLODs(lodFilename);
+    }
 
-    FbxStringList uvSetNames;
-    fbxMesh->GetUVSetNames(uvSetNames);
-    FbxLayerElementUV *uvLayer = fbxMesh->GetLayer(0)->GetUVs();
+    BuildMeshlets();
+}
+
+string Model::lodCacheDirectory = "lods";
+
+Model::Model()
+{
+    
+}
+
+Model::~Model()
+{
     
-    for(int p = 0; p < triCount; ++p)
-    {
-        for(int v = 0; v < 3; ++v)
-        {
-            // Get vertex position
-            int vertIndex = fbxMesh->GetPolygonVertex(p, v);
-            Vec3 vertex = FromFbxType(fbxVertices[vertIndex]);
-            
-            // Get normal
-            FbxVector4 fbxNormal;
-            fbxMesh->GetPolygonVertexNormal(p, v, fbxNormal);
-            fbxNormal.Normalize();
-            Vec3 normal = FromFbxType(fbxNormal);
-
-            // Get texture coordinate
-            FbxVector2 fbxTexcoord(0, 0);
-            
-            if(uvLayer)
-            {
-                switch(uvLayer->GetMappingMode())
+}
+
+void Model::LoadFromFBXFile(const string &filename, JobSystem* jobSystem)
+{
+    try
+    {
+        FbxFile file(filename, jobSystem);
+
+        FbxScene scene(file);
+
+        // the first mesh that's in the scene
+        for(auto& object : scene.objects->children)
+        {
+            if(!IsObject(object, "Geometry", "Mesh"))
+                continue;
+
+            const FbxFile::Node* model = scene.FindParentModel(object.properties[0].AsInt());
+            if(!model)
+                continue;
+
+            FbxTransform globalTransform = scene.GetGlobalTransform(*model);
+
+            auto& q = globalTransform.rotation;
+            defaultTransfrom.SetPosition( FromFbxVector(globalTransform.translation) );
+            defaultTransfrom.SetScale( FromFbxVector(globalTransform.scale) );
+            defaultTransfrom.SetRotation( Quat((float)q.x, (float)q.y, (float)q.z, (float)q.w) );
+
+            vector<uint32_t> vertexControlPoints;
+            size_t controlPointCount = LoadMeshData(object, vertexControlPoints, jobSystem);
+
+            if(!LoadSkin(scene, object, vertexControlPoints, controlPointCount, skeleton, skinWeights, animations))
+                skinWeights.clear();
+
+            RecalcBounds();
+            return;
+        }
+
+        throw runtime_error("Mesh node not found.");
+    }
+    catch(const exception &exception)
+    {
+        cout << "Failed to load FBX file: " << exception.what() << endl;
+        vertices.clear();
+        skeleton = Skeleton();
+        skinWeights.clear();
+        animations.clear();
+    }
+}
+
+size_t Model::LoadMeshData(const FbxFile::Node &geometry, vector<uint32_t>& vertexControlPoints, JobSystem* jobSystem)
+{
+    const FbxFile::Node* controlPointsNode = geometry.Find("Vertices");
+    const FbxFile::Node* polygonsNode = geometry.Find("PolygonVertexIndex");
+
+    if(!controlPointsNode || !polygonsNode || controlPointsNode->properties.empty() || polygonsNode->properties.empty())
+        throw runtime_error("Mesh has no vertices.");
+
+    vector<double> controlPoints;
+    vector<int32_t> polygonVertices;
+    controlPointsNode->properties[0].GetArray(controlPoints);
+    polygonsNode->properties[0].GetArray(polygonVertices);
+
+    size_t controlPointCount = controlPoints.size() / 3;
+
+    // a negative index, with its bits flipped, ends a polygon
+    struct Polygon
+    {
+        size_t first; // in polygonVertices
+        size_t last;
+        size_t index;
+    };
+
+    vector<Polygon> polygons;
+    size_t polygonCount = 0;
+    size_t first = 0;
+
+    for(size_t i = 0; i < polygonVertices.size(); ++i)
+    {
+        int32_t index = polygonVertices[i];
+        if(index < 0)
+            index = ~index;
+
+        if((size_t)index >= controlPointCount)
+            throw runtime_error("Mesh has a polygon with an invalid vertex.");
+
+        if(polygonVertices[i] < 0)
+        {
+            if(i - first >= 2)
+                polygons.push_back({ first, i, polygonCount });
+
+            first = i + 1;
+            ++polygonCount;
+        }
+    }
+
+    LayerElement normals;
+    bool foundNormals = false;
+    vector<LayerElement> uvSets;
+
+    for(auto& child : geometry.children)
+    {
+        if(child.name == "LayerElementNormal" && !foundNormals)
+        {
+            normals.Load(child, "Normals", "NormalsIndex", 3);
+            foundNormals = true;
+        }
+        else if(child.name == "LayerElementUV")
+        {
+            uvSets.emplace_back();
+            uvSets.back().Load(child, "UV", "UVIndex", 2);
+        }
+    }
+
+    // a second uv set holds unique, non-overlapping lightmap coordinates
+    hasLightmapCoords = uvSets.size() > 1;
+
+    // the polygons are split into triangle fans, in chunks that can go to different threads.
+    // a polygon with n vertices makes n - 2 triangles.
+    const size_t ChunkSize = 4096;
+    size_t chunkCount = (polygons.size() + ChunkSize - 1) / ChunkSize;
+
+    vector<size_t> chunkVertices(chunkCount + 1, 0);
+
+    for(size_t p = 0; p < polygons.size(); ++p)
+        chunkVertices[p / ChunkSize + 1] += (polygons[p].last - polygons[p].first - 1) * 3;
+
+    for(size_t c = 0; c < chunkCount; ++c)
+        chunkVertices[c + 1] += chunkVertices[c];
+
+    vertices.clear();
+    vertices.resize(chunkVertices[chunkCount]);
+    vertexControlPoints.resize(vertices.size());
+
+    auto triangulate = [&](size_t chunk)
+    {
+        Vertex* out = vertices.data() + chunkVertices[chunk];
+        uint32_t* outControlPoints = vertexControlPoints.data() + chunkVertices[chunk];
+        size_t firstPolygon = chunk * ChunkSize;
+        size_t lastPolygon = min(firstPolygon + ChunkSize, polygons.size());
+
+        for(size_t p = firstPolygon; p < lastPolygon; ++p)
+        {
+            const Polygon& polygon = polygons[p];
+
+            for(size_t i = polygon.first + 1; i < polygon.last; ++i)
+            {
+                size_t corners[3] = { polygon.first, i, i + 1 };
+
+                for(size_t corner : corners)
                 {
-                case FbxLayerElement::eByControlPoint:
-                    fbxTexcoord = uvLayer->mDirectArray->GetAt(vertIndex);
-                    break;
-
-                case FbxLayerElement::eByPolygonVertex:
-                    const char *setName = uvSetNames[0];
-                    bool unmapped = false;
-                    fbxMesh->GetPolygonVertexUV(p, v, setName, fbxTexcoord, unmapped);
-                    break;
-                }
-            }
+                    int32_t index = polygonVertices[corner];
+                    size_t controlPoint = (size_t)(index < 0 ? ~index : index);
+
+                    Vec3 vertex = FromFbxVector(&controlPoints[controlPoint * 3]);
+
+                    double n[3] = { 0, 0, 0 };
+                    normals.Get(corner, controlPoint, polygon.index, n);
+
+                    double length = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                    if(length > 0)
+                    {
+                        n[0] /= length;
+                        n[1] /= length;
+                        n[2] /= length;
+                    }
 
-            Vec2 texcoord = FromFbxType(fbxTexcoord);
+                    Vec3 normal = FromFbxVector(n);
 
-            vertices.emplace_back(vertex, normal, texcoord);
+                    double uv[2] = { 0, 0 };
+                    if(!uvSets.empty())
+                        uvSets[0].Get(corner, controlPoint, polygon.index, uv);
+
+                    Vec2 texcoord = FromFbxUV(uv);
+                    Vec2 lightmapCoord = texcoord;
+
+                    if(hasLightmapCoords && uvSets[1].Get(corner, controlPoint, polygon.index, uv))
+                        lightmapCoord = FromFbxUV(uv);
+
+                    *out++ = Vertex(vertex, normal, texcoord, lightmapCoord, vertex);
+                    *outControlPoints++ = (uint32_t)controlPoint;
+                }
+            }
         }
+    };
+
+    if(jobSystem)
+    {
+        jobSystem->ParallelFor(chunkCount, triangulate);
     }
+    else
+    {
+        for(size_t chunk = 0; chunk < chunkCount; ++chunk)
+            triangulate(chunk);
+    }
+
+    return controlPointCount;
 }
 
 void Model::RecalcBounds()
@@ -183,28 +1013,372 @@ void Model::RecalcBounds()
     }
 }
 
-Vec3 Model::FromFbxType(const FbxVector4 &v)
+int Model::lodCount() const {
+    return packed() ? (int)packedLods.size() : 1 + (int)lods.size();
+}
+
+const Model::VertexList& Model::GetVertices(int lod) const {
+    return lod == 0 ? vertices : lods[lod - 1];
+}
+
+size_t Model::GetVertexCount(int lod) const {
+    return packed() ? packedLods[lod].size() : GetVertices(lod).size();
+}
+
+int Model::SelectLOD(float screenSize, int current) const
+{
+    int lod = 0;
+    float threshold = lodSize;
+
+    while(lod + 1 < lodCount())
+    {
+        // getting finer than the current LOD takes a bit more than getting coarser
+        float t = lod < current ? threshold * lodHysteresis : threshold;
+        if(screenSize >= t)
+            break;
+
+        ++lod;
+        threshold *= 0.5f;
+    }
+
+    return lod;
+}
+
+void Model::GenerateLODs()
+{
+    lods.clear();
+
+    size_t triCount = vertices.size() / 3;
+    if(triCount / 2 < MinLODTriangles)
+        return;
+
+    // each LOD carries on simplifying from the one before
+    MeshSimplifier simplifier(vertices, hasLightmapCoords);
+    triCount = simplifier.triangleCount();
+
+    while(lodCount() < MaxLODs)
+    {
+        size_t target = triCount / 2;
+        if(target < MinLODTriangles)
+            break;
+
+        simplifier.Simplify(target);
+
+        // the seams and borders are all that's left
+        size_t reached = simplifier.triangleCount();
+        if(reached > triCount * 3 / 4)
+            break;
+
+        lods.emplace_back();
+        simplifier.GetVertices(lods.back());
+        triCount = reached;
+    }
+}
+
+void Model::BuildMeshlets()
+{
+    meshlets.resize(lodCount());
+
+    BuildMeshlets(vertices, meshlets[0]);
+
+    for(size_t i = 0; i < lods.size(); ++i)
+        BuildMeshlets(lods[i], meshlets[i + 1]);
+}
+
+void Model::BuildMeshlets(VertexList& vertices, MeshletList& meshlets)
+{
+    meshlets.clear();
+
+    size_t triCount = vertices.size() / 3;
+    if(triCount == 0)
+        return;
+
+    Box bounds(Vec3(FLT_MAX, FLT_MAX, FLT_MAX), Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+    for(auto& v : vertices)
+    {
+        bounds.vmin.x = min(bounds.vmin.x, v.position.x);
+        bounds.vmin.y = min(bounds.vmin.y, v.position.y);
+        bounds.vmin.z = min(bounds.vmin.z, v.position.z);
+        bounds.vmax.x = max(bounds.vmax.x, v.position.x);
+        bounds.vmax.y = max(bounds.vmax.y, v.position.y);
+        bounds.vmax.z = max(bounds.vmax.z, v.position.z);
+    }
+
+    Vec3 extent = bounds.vmax - bounds.vmin;
+    Vec3 scale(extent.x > 0 ? 1023.0f / extent.x : 0.0f,
+               extent.y > 0 ? 1023.0f / extent.y : 0.0f,
+               extent.z > 0 ? 1023.0f / extent.z : 0.0f);
+
+    // quantizes 'x' to 10 bits and spreads them out to every third bit
+    auto spread = [](float f) {
+        uint32_t x = (uint32_t)Math::Clamp(f, 0.0f, 1023.0f);
+        x = (x | (x << 16)) & 0x30000FF;
+        x = (x | (x << 8)) & 0x300F00F;
+        x = (x | (x << 4)) & 0x30C30C3;
+        x = (x | (x << 2)) & 0x9249249;
+        return x;
+    };
+
+    // triangles are grouped by the axis their normal is closest to, and then ordered along a
+    // z-order curve through their centers, so each run of them is close together and faces one way
+    vector<uint64_t> keys(triCount);
+    vector<Vec3, AlignedAllocator<Vec3, 16>> normals(triCount);
+
+    for(size_t t = 0; t < triCount; ++t)
+    {
+        Vec3 p0 = vertices[t * 3].position;
+        Vec3 p1 = vertices[t * 3 + 1].position;
+        Vec3 p2 = vertices[t * 3 + 2].position;
+
+        Vec3 n = (p1 - p0).Cross(p2 - p0);
+        float length = n.Length();
+        normals[t] = length > 0 ? n / length : Vec3::zero;
+
+        Vec3 a(fabs(n.x), fabs(n.y), fabs(n.z));
+        uint64_t axis = a.x >= a.y && a.x >= a.z ? (n.x < 0 ? 1 : 0)
+                      : a.y >= a.z               ? (n.y < 0 ? 3 : 2)
+                      :                            (n.z < 0 ? 5 : 4);
+
+        Vec3 c = (p0 + p1 + p2) / 3.0f - bounds.vmin;
+        uint32_t morton = spread(c.x * scale.x)
+                        | spread(c.y * scale.y) << 1
+                        | spread(c.z * scale.z) << 2;
+
+        keys[t] = (axis << 61) | ((uint64_t)morton << 31) | t;
+    }
+
+    sort(keys.begin(), keys.end());
+
+    VertexList sorted;
+    sorted.reserve(vertices.size());
+
+    for(size_t i = 0; i < triCount; )
+    {
+        uint64_t axis = keys[i] >> 61;
+        size_t first = i;
+        size_t last = min(first + MeshletSize, triCount);
+
+        while(i < last && keys[i] >> 61 == axis)
+            ++i;
+
+        Meshlet meshlet;
+        meshlet.first = (uint32_t)sorted.size();
+        meshlet.count = (uint32_t)((i - first) * 3);
+
+        Box box(Vec3(FLT_MAX, FLT_MAX, FLT_MAX), Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+        Vec3 axisSum = Vec3::zero;
+
+        for(size_t k = first; k < i; ++k)
+        {
+            size_t t = (size_t)(keys[k] & 0x7FFFFFFF);
+            for(int j = 0; j < 3; ++j)
+            {
+                const Vertex& v = vertices[t * 3 + j];
+                box.vmin.x = min(box.vmin.x, v.position.x);
+                box.vmin.y = min(box.vmin.y, v.position.y);
+                box.vmin.z = min(box.vmin.z, v.position.z);
+                box.vmax.x = max(box.vmax.x, v.position.x);
+                box.vmax.y = max(box.vmax.y, v.position.y);
+                box.vmax.z = max(box.vmax.z, v.position.z);
+                sorted.push_back(v);
+            }
+
+            axisSum += normals[t];
+        }
+
+        Vec3 center = (box.vmin + box.vmax) * 0.5f;
+        float radius = 0.0f;
+
+        for(uint32_t v = meshlet.first; v < meshlet.first + meshlet.count; ++v)
+            radius = max(radius, center.DistanceSq(sorted[v].position));
+
+        meshlet.bounds = Sphere(center, sqrt(radius));
+
+        // triangles without area don't face anywhere, so they don't widen the cone
+        float axisLength = axisSum.Length();
+        meshlet.coneAxis = axisLength > 0 ? axisSum / axisLength : Vec3::zero;
+        meshlet.coneCos = axisLength > 0 ? 1.0f : -1.0f;
+
+        for(size_t k = first; k < i && meshlet.coneCos > 0; ++k)
+        {
+            const Vec3& n = normals[(size_t)(keys[k] & 0x7FFFFFFF)];
+            if(n.LengthSq() > 0)
+                meshlet.coneCos = min(meshlet.coneCos, n.Dot(meshlet.coneAxis));
+        }
+
+        meshlet.coneSin = meshlet.coneCos > 0 ? sqrt(max(1.0f - meshlet.coneCos * meshlet.coneCos, 0.0f)) : 1.0f;
+        meshlets.push_back(meshlet);
+    }
+
+    vertices = move(sorted);
+}
+
+void Model::Pack()
 {
-    return Vec3((float)v[0] * 0.01f, (float)v[2] * 0.01f, (float)v[1] * 0.01f);
+    // skinned vertices are rewritten every frame
+    if(vertices.empty() || packed() || skinned())
+        return;
+
+    // the simplified LODs can end up a little outside of the model's box
+    Box bounds(vertices[0].position, vertices[0].position);
+
+    for(int lod = 0; lod < lodCount(); ++lod)
+    {
+        for(auto& v : GetVertices(lod))
+        {
+            bounds.vmin = Vec3(min(bounds.vmin.x, v.position.x), min(bounds.vmin.y, v.position.y), min(bounds.vmin.z, v.position.z));
+            bounds.vmax = Vec3(max(bounds.vmax.x, v.position.x), max(bounds.vmax.y, v.position.y), max(bounds.vmax.z, v.position.z));
+        }
+    }
+
+    quantization = VertexQuantization(bounds);
+
+    vector<PackedVertexList> packedVertices(lodCount());
+
+    for(int lod = 0; lod < lodCount(); ++lod)
+    {
+        auto& lodVertices = GetVertices(lod);
+        packedVertices[lod].resize(lodVertices.size());
+
+        for(size_t i = 0; i < lodVertices.size(); ++i)
+            packedVertices[lod][i] = PackedVertex::Pack(lodVertices[i], quantization);
+    }
+
+    packedLods = move(packedVertices);
+    VertexList().swap(vertices);
+    vector<VertexList>().swap(lods);
+
+    // what's drawn is a little different
+    VerticesChanged();
 }
 
-Vec2 Model::FromFbxType(const FbxVector2 &v)
+bool Model::LoadLODs(const string &filename)
 {
-    return Vec2((float)v[0], 1.0f - (float)v[1]);
+    ifstream fin(filename, ios::in | ios::binary);
+    if(!fin)
+        return false;
+
+    uint32_t magic = 0, version = 0, vertexSize = 0, count = 0;
+    uint64_t vertexCount = 0, hash = 0;
+
+    fin.read((char*)&magic, sizeof(magic));
+    fin.read((char*)&version, sizeof(version));
+    fin.read((char*)&vertexSize, sizeof(vertexSize));
+    fin.read((char*)&vertexCount, sizeof(vertexCount));
+    fin.read((char*)&hash, sizeof(hash));
+    fin.read((char*)&count, sizeof(count));
+
+    // LODs of a different model, or written by a different build
+    if(!fin || magic != LODFileMagic || version != LODFileVersion || vertexSize != sizeof(Vertex)
+    || vertexCount != vertices.size() || hash != GetVertexHash() || count >= (uint32_t)MaxLODs)
+        return false;
+
+    vector<VertexList> loaded(count);
+
+    for(auto& lod : loaded)
+    {
+        uint64_t lodVertexCount = 0;
+        fin.read((char*)&lodVertexCount, sizeof(lodVertexCount));
+
+        if(!fin || lodVertexCount > vertexCount)
+            return false;
+
+        lod.resize((size_t)lodVertexCount);
+        fin.read((char*)lod.data(), lodVertexCount * sizeof(Vertex));
+    }
+
+    if(!fin)
+        return false;
+
+    lods = move(loaded);
+    return true;
+}
+
+void Model::SaveLODs(const string &filename) const
+{
+#ifdef _WIN32
+    CreateDirectoryA(lodCacheDirectory.c_str(), nullptr);
+#else
+    mkdir(lodCacheDirectory.c_str(), 0755);
+#endif
+
+    // the same model can be loaded by several jobs or processes at once, so each writes a
+    // file of its own and moves it into place, and readers never see one half written
+    string tempFilename = filename + "." + to_string(random_device()()) + ".tmp";
+
+    // the LODs are generated again next time if this fails
+    ofstream fout(tempFilename, ios::out | ios::binary);
+    if(!fout)
+        return;
+
+    uint32_t magic = LODFileMagic;
+    uint32_t version = LODFileVersion;
+    uint32_t vertexSize = sizeof(Vertex);
+    uint64_t vertexCount = vertices.size();
+    uint64_t hash = GetVertexHash();
+    uint32_t count = (uint32_t)lods.size();
+
+    fout.write((const char*)&magic, sizeof(magic));
+    fout.write((const char*)&version, sizeof(version));
+    fout.write((const char*)&vertexSize, sizeof(vertexSize));
+    fout.write((const char*)&vertexCount, sizeof(vertexCount));
+    fout.write((const char*)&hash, sizeof(hash));
+    fout.write((const char*)&count, sizeof(count));
+
+    for(auto& lod : lods)
+    {
+        uint64_t lodVertexCount = lod.size();
+        fout.write((const char*)&lodVertexCount, sizeof(lodVertexCount));
+        fout.write((const char*)lod.data(), lod.size() * sizeof(Vertex));
+    }
+
+    fout.close();
+
+#ifdef _WIN32
+    bool moved = fout && MoveFileExA(tempFilename.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    bool moved = fout && rename(tempFilename.c_str(), filename.c_str()) == 0;
+#endif
+
+    if(!moved)
+        remove(tempFilename.c_str());
 }
 
-Quat Model::FromFbxType(const FbxQuaternion &q)
+string Model::GetLODFilename(const string &filename)
 {
-    return Quat((float)q[0], (float)q[1], (float)q[2], (float)q[3]);
+    // the path is flattened into the name, so models with the same name in different directories don't collide
+    string name = filename;
+    replace_if(name.begin(), name.end(), [](char c) { return c == '/' || c == '\\' || c == ':'; }, '_');
+
+    if(lodCacheDirectory.empty())
+        return name + ".lods";
+
+    return lodCacheDirectory + "/" + name + ".lods";
 }
 
-Mat4 Model::FromFbxType(const FbxAMatrix &m)
+uint64_t Model::GetVertexHash() const
 {
-    FbxVector4    p = m.GetT();
-    FbxVector4    s = m.GetS();
-    FbxQuaternion q = m.GetQ();
-    
-    return Mat4::Transform(Vec3((float)p[0], (float)p[1], (float)p[2]),
-                           Vec3((float)s[0], (float)s[1], (float)s[2]),
-                           Quat((float)q[0], (float)q[1], (float)q[2], (float)q[3]));
+    // FNV-1a over everything the simplifier looks at
+    uint64_t hash = 14695981039346656037ull;
+
+    auto add = [&hash](const void* data, size_t size) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        for(size_t i = 0; i < size; ++i)
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+    };
+
+    add(&hasLightmapCoords, sizeof(hasLightmapCoords));
+
+    for(auto& v : vertices)
+    {
+        float values[10] = {
+            v.position.x, v.position.y, v.position.z,
+            v.normal.x, v.normal.y, v.normal.z,
+            v.texcoord.x, v.texcoord.y,
+            v.lightmapCoord.x, v.lightmapCoord.y
+        };
+        add(values, sizeof(values));
+    }
+
+    return hash;
 }
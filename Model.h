@@ -7,12 +7,15 @@
 #include "Math.h"
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <iostream>
 #include <vector>
 #include <memory>
-#include <fbxsdk.h>
+#include "FbxFile.h"
+#include "PackedVertex.h"
+#include "Skeleton.h"
 #include "Transform.h"
 #include "Vertex.h"
 #include "Mem.h"
@@ -21,27 +24,133 @@ using namespace std;
 
 class Texture;
 
+// a small group of a model's triangles that are near each other and face about the same way,
+// so that they can be culled together before their vertices are processed
+struct Meshlet
+{
+    uint32_t first; // the vertices are [first, first + count)
+    uint32_t count;
+    Sphere bounds;
+    Vec3 coneAxis;  // average of the triangles' normals
+    float coneCos;  // cosine and sine of the widest angle between the axis and a normal.
+    float coneSin;  // coneCos is 0 or less if the triangles face too many ways to cull them by it.
+};
+
 class Model
 {
 public:
-    vector<Vertex, AlignedAllocator<Vertex, 16>> vertices;
+    typedef vector<Vertex, AlignedAllocator<Vertex, 16>> VertexList;
+    typedef vector<Meshlet, AlignedAllocator<Meshlet, 16>> MeshletList;
+    typedef vector<PackedVertex> PackedVertexList;
+
+    // most triangles in a meshlet
+    static constexpr size_t MeshletSize = 128;
+
+    // most levels of detail, including the model itself
+    static constexpr int MaxLODs = 5;
+
+    // LODs stop before they get to fewer triangles than this
+    static constexpr size_t MinLODTriangles = 32;
+
+    VertexList vertices;
+
+    // simplified copies of 'vertices', each with about half as many triangles as the
+    // one before. generated when the model is loaded and kept in lodCacheDirectory.
+    vector<VertexList> lods;
+
+    // models covering less of the screen height than this are drawn with LOD 1, less than half
+    // of it with LOD 2 and so on. they only go back to a finer LOD once they grow past its
+    // threshold * lodHysteresis, so models near a threshold don't keep popping between two.
+    float lodSize = 0.25f;
+    float lodHysteresis = 1.25f;
+
+    // by LOD. the triangles of each LOD are sorted into meshlets when the model is loaded
+    vector<MeshletList> meshlets;
+
+    // by LOD, once the model is packed. 'vertices' and 'lods' are empty then.
+    vector<PackedVertexList> packedLods;
+    VertexQuantization quantization;
+
+    // the bones the vertices follow, and the weights of each vertex, for skinned models.
+    // they're loaded without LODs or meshlets, and aren't packed. see SkinnedObject.
+    Skeleton skeleton;
+    vector<SkinWeights> skinWeights;
+    vector<AnimationClip> animations;
+
     Transform defaultTransfrom;
 
+    // true if the vertices carry unique lightmap coordinates, either from the file's
+    // second uv set or generated by LightmapBaker. otherwise lightmapCoord is a copy of texcoord.
+    bool hasLightmapCoords = false;
+
+    // grid size of generated lightmap coordinates, 0 if they came from the file
+    int lightmapGridSize = 0;
+
     Box bbox;
     Sphere bsphere;
 
-    Model(const string &filename);
+    // where the LODs generated for models loaded from files are kept, one file per model named
+    // after its path. created when missing. "lods" in the working directory by default, next to
+    // the asset pack, or the working directory itself if empty. to be set before any model is loaded.
+    static string lodCacheDirectory;
+
+    // the file is read and triangulated on 'jobSystem', if there is one
+    Model(const string &filename, JobSystem* jobSystem = nullptr);
+
+    // an empty model, for whoever creates it to fill in, like AssetPack
+    Model();
     ~Model();
 
     void RecalcBounds();
 
+    // LOD 0 is 'vertices'
+    int lodCount() const;
+    const VertexList& GetVertices(int lod) const;
+    size_t GetVertexCount(int lod) const;
+
+    // picks the LOD for a model 'screenSize' high, see Camera::GetScreenSize.
+    // 'current' is the LOD it was drawn with before.
+    int SelectLOD(float screenSize, int current) const;
+
+    // simplifies 'vertices' into 'lods'
+    void GenerateLODs();
+
+    // reorders the triangles of every LOD into meshlets
+    void BuildMeshlets();
+
+    // replaces the vertices of every LOD with PackedVertex, which take less than a third of
+    // the memory, and are unpacked as they're drawn. to be called once the model is done with,
+    // since what needs the full vertices, like LOD generation and lightmap baking, skips it after.
+    void Pack();
+
+    bool packed() const {
+        return !packedLods.empty();
+    }
+
+    bool skinned() const {
+        return !skinWeights.empty();
+    }
+
+    // to be called after changing the vertices, so that geometry cached from them is rebuilt.
+    // the LODs and meshlets are left as they are, GenerateLODs() and BuildMeshlets()
+    // have to be called if the shape changed.
+    void VerticesChanged() {
+        ++_version;
+    }
+
+    uint32_t GetVersion() const {
+        return _version;
+    }
+
 private:
-    void LoadFromFBXFile(const string &filename);
-    bool LoadFirstMeshNode_R(FbxManager *sdkManager, FbxNode *pNode);
-    void LoadMeshData(FbxMesh *fbxMesh);
-
-    Vec3 FromFbxType(const FbxVector4 &v);
-    Vec2 FromFbxType(const FbxVector2 &v);
-    Quat FromFbxType(const FbxQuaternion &q);
-    Mat4 FromFbxType(const FbxAMatrix &m);
+    uint32_t _version = 0;
+
+    void LoadFromFBXFile(const string &filename, JobSystem* jobSystem);
+    bool LoadLODs(const string &filename);
+    void SaveLODs(const string &filename) const;
+    static string GetLODFilename(const string &filename);
+    uint64_t GetVertexHash() const;
+    static void BuildMeshlets(VertexList& vertices, MeshletList& meshlets);
+    // returns the number of control points, and the one each vertex came from
+    size_t LoadMeshData(const FbxFile::Node &geometry, vector<uint32_t>& vertexControlPoints, JobSystem* jobSystem);
 };
@@ -0,0 +1,233 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "PackedVertex.h"
+#include "SIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+// the uvs are unpacked together, with a single store
+static_assert(offsetof(Vertex, texcoord) % 16 == 0 && offsetof(Vertex, lightmapCoord) == offsetof(Vertex, texcoord) + sizeof(Vec2),
+              "Vertex::texcoord and lightmapCoord have to share 16 aligned bytes.");
+
+namespace
+{
+    uint16_t ToHalf(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        uint32_t sign = (bits >> 16) & 0x8000;
+        uint32_t abs = bits & 0x7FFFFFFF;
+
+        // too large, infinite or not a number
+        if(abs >= 0x47800000)
+            return (uint16_t)(sign | (abs > 0x7F800000 ? 0x7E00 : 0x7C00));
+
+        // too small for a normal half, the steps are 2^-24
+        if(abs < 0x38800000)
+        {
+            float a;
+            memcpy(&a, &abs, sizeof(a));
+            return (uint16_t)(sign | (uint32_t)lrintf(a * 16777216.0f));
+        }
+
+        // the exponent is rebiased, and the 13 bits dropped from the mantissa round to nearest even.
+        // rounding up can carry into the exponent, up to infinity.
+        uint32_t half = (abs - 0x38000000) >> 13;
+        uint32_t rest = abs & 0x1FFF;
+
+        if(rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+            ++half;
+
+        return (uint16_t)(sign | half);
+    }
+
+    int16_t ToSnorm16(float value) {
+        return (int16_t)lrintf(Math::Clamp(value, -1.0f, 1.0f) * 32767.0f);
+    }
+
+    uint16_t ToUnorm16(float value, float offset, float scale) {
+        return scale > 0.0f ? (uint16_t)lrintf(Math::Clamp((value - offset) / scale, 0.0f, 65535.0f)) : 0;
+    }
+
+#if USE_SSE
+    // 4 half floats, in the low 16 bits of each lane
+    __m128 HalfToFloat(__m128i half)
+    {
+        const __m128i signMask = _mm_set1_epi32(0x8000);
+        const __m128i valueMask = _mm_set1_epi32(0x7FFF);
+        const __m128i exponentMask = _mm_set1_epi32(0x7C00);
+        const __m128 rebias = _mm_castsi128_ps(_mm_set1_epi32(0x77800000)); // 2^112
+        const __m128 infinity = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+
+        // shifted into place, the bits make a float 2^112 times too small,
+        // which the multiply fixes for small halves too
+        __m128i sign = _mm_slli_epi32(_mm_and_si128(half, signMask), 16);
+        __m128i bits = _mm_slli_epi32(_mm_and_si128(half, valueMask), 13);
+        __m128 value = _mm_mul_ps(_mm_castsi128_ps(bits), rebias);
+
+        __m128i special = _mm_cmpeq_epi32(_mm_and_si128(half, exponentMask), exponentMask);
+        value = _mm_or_ps(value, _mm_and_ps(_mm_castsi128_ps(special), infinity));
+
+        return _mm_or_ps(value, _mm_castsi128_ps(sign));
+    }
+
+    void Unpack4(const PackedVertex* src, __m128 offset, __m128 scale, Vertex* dst)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 snorm = _mm_set1_ps(1.0f / 32767.0f);
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+
+        int32_t packedNormals[4];
+        for(int i = 0; i < 4; ++i)
+            memcpy(&packedNormals[i], src[i].normal, sizeof(int32_t));
+
+        __m128i n = _mm_loadu_si128((const __m128i*)packedNormals);
+        __m128 x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(n, 16), 16)), snorm);
+        __m128 y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(n, 16)), snorm);
+
+        // normals facing -z were folded over the diagonals, and are unfolded by how far z went below 0
+        __m128 z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_andnot_ps(signMask, y));
+        __m128 t = _mm_max_ps(_mm_sub_ps(zero, z), zero);
+        x = _mm_sub_ps(x, _mm_or_ps(t, _mm_and_ps(x, signMask)));
+        y = _mm_sub_ps(y, _mm_or_ps(t, _mm_and_ps(y, signMask)));
+
+        __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+        __m128 invLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSq));
+        x = _mm_mul_ps(x, invLength);
+        y = _mm_mul_ps(y, invLength);
+        z = _mm_mul_ps(z, invLength);
+
+        __m128 w = zero;
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        const __m128 normals[4] = { x, y, z, w };
+
+        for(int i = 0; i < 4; ++i)
+        {
+            // the 8 bytes loaded for the position end with the normal's first half,
+            // which the scale's last lane zeroes
+            __m128i position = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i*)src[i].position));
+            __m128 pos = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(position), scale), offset);
+            __m128 uvs = HalfToFloat(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i*)src[i].texcoord)));
+
+            _mm_store_ps(&dst[i].position.x, pos);
+            _mm_store_ps(&dst[i].normal.x, normals[i]);
+            _mm_store_ps(&dst[i].texcoord.x, uvs);
+            _mm_store_ps(&dst[i].worldPos.x, pos);
+        }
+    }
+#else
+    float HalfToFloat(uint16_t half)
+    {
+        // shifted into place, the bits make a float 2^112 times too small,
+        // which the multiply fixes for small halves too
+        uint32_t bits = (uint32_t)(half & 0x7FFF) << 13;
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        value *= 5.192296858534828e33f; // 2^112
+        memcpy(&bits, &value, sizeof(bits));
+
+        if((half & 0x7C00) == 0x7C00)
+            bits |= 0x7F800000;
+
+        bits |= (uint32_t)(half & 0x8000) << 16;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void Unpack1(const PackedVertex& src, const VertexQuantization& quantization, Vertex& dst)
+    {
+        const float snorm = 1.0f / 32767.0f;
+
+        float x = src.normal[0] * snorm;
+        float y = src.normal[1] * snorm;
+
+        // normals facing -z were folded over the diagonals, and are unfolded by how far z went below 0
+        float z = 1.0f - fabs(x) - fabs(y);
+        float t = max(-z, 0.0f);
+        x -= copysign(t, x);
+        y -= copysign(t, y);
+
+        float invLength = 1.0f / sqrt(x * x + y * y + z * z);
+
+        Vec3 pos(src.position[0] * quantization.scale.x + quantization.offset.x,
+                 src.position[1] * quantization.scale.y + quantization.offset.y,
+                 src.position[2] * quantization.scale.z + quantization.offset.z);
+
+        dst.position = Vec4(pos, 0.0f);
+        dst.normal = Vec3(x * invLength, y * invLength, z * invLength);
+        dst.texcoord = Vec2(HalfToFloat(src.texcoord[0]), HalfToFloat(src.texcoord[1]));
+        dst.lightmapCoord = Vec2(HalfToFloat(src.lightmapCoord[0]), HalfToFloat(src.lightmapCoord[1]));
+        dst.worldPos = pos;
+    }
+#endif
+}
+
+VertexQuantization::VertexQuantization(const Box& bounds)
+    : offset(bounds.vmin), scale((bounds.vmax - bounds.vmin) / 65535.0f)
+{
+}
+
+PackedVertex PackedVertex::Pack(const Vertex& v, const VertexQuantization& quantization)
+{
+    const Vec3& offset = quantization.offset;
+    const Vec3& scale = quantization.scale;
+
+    PackedVertex packed;
+    packed.position[0] = ToUnorm16(v.position.x, offset.x, scale.x);
+    packed.position[1] = ToUnorm16(v.position.y, offset.y, scale.y);
+    packed.position[2] = ToUnorm16(v.position.z, offset.z, scale.z);
+
+    // projected onto the octahedron |x| + |y| + |z| = 1, with the half below z = 0 folded over the top
+    float sum = fabs(v.normal.x) + fabs(v.normal.y) + fabs(v.normal.z);
+    float x = sum > 0.0f ? v.normal.x / sum : 0.0f;
+    float y = sum > 0.0f ? v.normal.y / sum : 0.0f;
+
+    if(v.normal.z < 0.0f)
+    {
+        float folded = (1.0f - fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        y = (1.0f - fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = folded;
+    }
+
+    packed.normal[0] = ToSnorm16(x);
+    packed.normal[1] = ToSnorm16(y);
+
+    packed.texcoord[0] = ToHalf(v.texcoord.x);
+    packed.texcoord[1] = ToHalf(v.texcoord.y);
+    packed.lightmapCoord[0] = ToHalf(v.lightmapCoord.x);
+    packed.lightmapCoord[1] = ToHalf(v.lightmapCoord.y);
+
+    return packed;
+}
+
+void PackedVertex::Unpack(const PackedVertex* src, size_t count, const VertexQuantization& quantization, Vertex* dst)
+{
+#if USE_SSE
+    const __m128 offset = _mm_setr_ps(quantization.offset.x, quantization.offset.y, quantization.offset.z, 0.0f);
+    const __m128 scale = _mm_setr_ps(quantization.scale.x, quantization.scale.y, quantization.scale.z, 0.0f);
+
+    for(; count >= 4; count -= 4, src += 4, dst += 4)
+        Unpack4(src, offset, scale, dst);
+
+    if(count > 0)
+    {
+        // the last few go through a copy padded to 4
+        PackedVertex last[4] = {};
+        Vertex unpacked[4];
+
+        copy(src, src + count, last);
+        Unpack4(last, offset, scale, unpacked);
+        copy(unpacked, unpacked + count, dst);
+    }
+#else
+    for(size_t i = 0; i < count; ++i)
+        Unpack1(src[i], quantization, dst[i]);
+#endif
+}
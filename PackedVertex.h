@@ -0,0 +1,39 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Math.h"
+#include "Vertex.h"
+using namespace std;
+
+// maps a packed model's positions back to model space: position = offset + packed * scale
+struct VertexQuantization
+{
+    Vec3 offset = Vec3::zero; // the min corner of the box the positions are packed into
+    Vec3 scale = Vec3::zero;  // of one step along each axis, 1/65535th of the box
+
+    VertexQuantization(){}
+    explicit VertexQuantization(const Box& bounds);
+};
+
+// A model's vertex in 18 bytes instead of the 64 of a Vertex.
+// The position is 16 bits per axis, relative to the model's box. The normal is octahedral,
+// folded onto the two axes of an octahedron's projection, 16 bits each. The uvs are half floats.
+// worldPos isn't stored, since it's a copy of the position until a shader transforms it.
+struct PackedVertex
+{
+    uint16_t position[3];
+    int16_t normal[2];
+    uint16_t texcoord[2];       // half floats
+    uint16_t lightmapCoord[2];
+
+    static PackedVertex Pack(const Vertex& v, const VertexQuantization& quantization);
+
+    // decodes whole groups of 4 vertices with SSE4.1, the normals of the 4 side by side,
+    // or one at a time without SSE
+    static void Unpack(const PackedVertex* src, size_t count, const VertexQuantization& quantization, Vertex* dst);
+};
@@ -31,7 +31,7 @@ public:
     RenderBuffer(RenderBuffer&& rb)
         : _data(move(rb._data)),
           _width(rb._width),
-          _height(rb._heigh),
+          _height(rb._height),
           _sampleCount(rb._sampleCount)
     {
         rb._width = 0;
@@ -74,6 +74,16 @@ public:
         std::fill(_data.get(), _data.get() + (_width * _height * _sampleCount), value);
     }
 
+    // fills every sample of the pixels in the rectangle
+    void Fill(int x, int y, int w, int h, T value)
+    {
+        for(int row = y; row < y + h; ++row)
+        {
+            T* samples = _data.get() + GetSampleOffset(x, row, 0);
+            std::fill(samples, samples + w * _sampleCount, value);
+        }
+    }
+
     T* data() {
         return _data.get();
     }
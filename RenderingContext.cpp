@@ -4,18 +4,46 @@
 *--------------------------------------------------------------------------------------------*/
 
 #include "RenderingContext.h"
-#include "Application.h"
-#include "RenderThread.h"
+#include "JobSystem.h"
+#include "LightClusters.h"
 #include "Model.h"
 #include "Shader.h"
 #include "Scene.h"
+#include "ShadowMap.h"
 #include <cmath>
 #include <array>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include "Application.h"
+#endif
 
+static_assert(RenderingContext::MaxFramesInFlight <= SceneObject::DrawStateCount,
+              "every frame in flight needs draw states of its own");
+
+#ifdef _WIN32
 RenderingContext::RenderingContext(Application* app, uint32_t width, uint32_t height, size_t threadCount)
+    : RenderingContext(app, width, height, make_shared<JobSystem>(threadCount))
+{
+}
+
+RenderingContext::RenderingContext(Application* app, uint32_t width, uint32_t height, const shared_ptr<JobSystem>& jobSystem)
+    : RenderingContext(width, height, jobSystem)
 {
-    _hWndTarget = (HWND)app->nativeWindowHandle();
-    _hDCTarget = GetDC(_hWndTarget);
+    _hWndTarget = (void*)app->nativeWindowHandle();
+    _hDCTarget = GetDC((HWND)_hWndTarget);
+}
+#endif
+
+RenderingContext::RenderingContext(uint32_t width, uint32_t height, const shared_ptr<JobSystem>& jobSystem)
+{
+    _hWndTarget = nullptr;
+    _hDCTarget = nullptr;
+    _target = nullptr;
+    _targetStride = 0;
 
     _width = width;
     _height = height;
@@ -28,27 +56,63 @@ RenderingContext::RenderingContext(Application* app, uint32_t width, uint32_t he
     _renderWidth = _width;
     _renderHeight = _height;
     _colorBuffer.Resize(width, height, 1);
+    _presentBuffer.Resize(width, height, 1);
     _depthBuffer.Resize(width, height, 1);
+    _presentBuffer.Clear();
+
+    for(auto& frame : _frames)
+    {
+        frame.lightClusters = AlignedMakeShared<LightClusters, 16>();
 
-    for(size_t i = 0; i < threadCount; ++i)
-        _renderThreads.push_back(make_unique<RenderThread>());
+        for(size_t i = 0; i < jobSystem->threadCount(); ++i)
+            frame.geometryArenas.push_back(make_unique<Arena>());
+    }
+
+    _frameIndex = 0;
+    _maxFramesInFlight = 1;
+    _rasterizingFrame = nullptr;
+    _frameNumber = 0;
+    _finishedFrameNumber = 0;
+    _vertexCacheSize = DefaultVertexCacheSize;
+    _vertexCacheUsed = 0;
+    _incrementalRendering = false;
+    _clearColorPending = false;
+    _clearDepthPending = false;
+    _jobSystem = jobSystem;
+    _jobGroup = _jobSystem->CreateGroup();
 }
 
 RenderingContext::~RenderingContext()
 {
+    Flush();
 
+    if(_scene && _scene->context == this)
+        _scene->context = nullptr;
+
+#ifdef _WIN32
+    if(_hDCTarget)
+        ReleaseDC((HWND)_hWndTarget, (HDC)_hDCTarget);
+#endif
+
+    _jobSystem->ReleaseGroup(_jobGroup);
 }
 
-void RenderingContext::clearColor(const Color &color) {
+void RenderingContext::clearColor(const Color &color)
+{
+    Flush();
     _clearColor = color;
+    _dirtyTiles.Invalidate();
 }
 
 Color RenderingContext::clearColor() const {
     return _clearColor;
 }
 
-void RenderingContext::rasterizationMode(RasterizationMode mode) {
+void RenderingContext::rasterizationMode(RasterizationMode mode)
+{
+    Flush();
     _rasterizationMode = mode;
+    _dirtyTiles.Invalidate();
 }
 
 RasterizationMode RenderingContext::rasterizationMode() const {
@@ -57,6 +121,8 @@ RasterizationMode RenderingContext::rasterizationMode() const {
 
 void RenderingContext::antiAliasingMode(AntiAliasingMode mode)
 {
+    Flush();
+
     if(mode == AntiAliasingMode::Off
     || (mode == AntiAliasingMode::MSAA_4X && _rasterizationMode == RasterizationMode::Scanline))
     {
@@ -92,6 +158,7 @@ void RenderingContext::antiAliasingMode(AntiAliasingMode mode)
     }
 
     _antiAliasingMode = mode;
+    _dirtyTiles.Invalidate();
 }
 
 AntiAliasingMode RenderingContext::antiAliasingMode() const
@@ -99,18 +166,88 @@ AntiAliasingMode RenderingContext::antiAliasingMode() const
     return _antiAliasingMode;
 }
 
-void RenderingContext::mipmapsEnabled(bool enabled) {
+void RenderingContext::mipmapsEnabled(bool enabled)
+{
+    Flush();
     _mipmapsEnabled = enabled;
+    _dirtyTiles.Invalidate();
 }
 
 bool RenderingContext::mipmapsEnabled() const {
     return _mipmapsEnabled;
 }
 
-HWND RenderingContext::targetWindow() const {
+void RenderingContext::incrementalRendering(bool enabled)
+{
+    _incrementalRendering = enabled;
+    _dirtyTiles.Invalidate();
+}
+
+bool RenderingContext::incrementalRendering() const {
+    return _incrementalRendering;
+}
+
+void RenderingContext::maxFramesInFlight(uint32_t count)
+{
+    Flush();
+    _maxFramesInFlight = Math::Clamp(count, 1u, MaxFramesInFlight);
+}
+
+uint32_t RenderingContext::maxFramesInFlight() const {
+    return _maxFramesInFlight;
+}
+
+void RenderingContext::vertexCacheSize(size_t bytes)
+{
+    Flush();
+    _vertexCacheSize = bytes;
+
+    if(_vertexCacheUsed > _vertexCacheSize)
+        ClearVertexCaches();
+}
+
+size_t RenderingContext::vertexCacheSize() const {
+    return _vertexCacheSize;
+}
+
+size_t RenderingContext::vertexCacheUsed() const {
+    return _vertexCacheUsed;
+}
+
+void RenderingContext::priority(int priority) {
+    _jobGroup->priority(priority);
+}
+
+int RenderingContext::priority() const {
+    return _jobGroup->priority();
+}
+
+void* RenderingContext::targetWindow() const {
     return _hWndTarget;
 }
 
+void RenderingContext::target(uint32_t* pixels, uint32_t stride)
+{
+    _target = pixels;
+    _targetStride = stride;
+}
+
+uint32_t* RenderingContext::target() const {
+    return _target;
+}
+
+JobSystem& RenderingContext::jobSystem() {
+    return *_jobSystem;
+}
+
+uint64_t RenderingContext::frameNumber() const {
+    return _frameNumber;
+}
+
+uint64_t RenderingContext::finishedFrameNumber() const {
+    return _finishedFrameNumber;
+}
+
 uint32_t RenderingContext::width() const {
     return _width;
 }
@@ -121,96 +258,1011 @@ uint32_t RenderingContext::height() const {
 
 void RenderingContext::Draw(const shared_ptr<Scene>& scene)
 {
-    _drawCalls.reserve(scene->objects.size());
+    if(scene->context && scene->context != this)
+        throw runtime_error("The scene is drawn by another rendering context.");
+
+    // the last scene is given up once the frames drawing it are finished
+    if(scene != _scene)
+    {
+        Flush();
+
+        if(_scene && _scene->context == this)
+            _scene->context = nullptr;
+
+        _scene = scene;
+        scene->context = this;
+    }
+
+    // frames alternate between slots. the one used by the frame before the
+    // previous one was finished before the previous frame started rasterizing.
+    uint32_t slot = _frameIndex;
+    Frame& frame = _frames[slot];
+    _frameIndex = (_frameIndex + 1) % MaxFramesInFlight;
+    ++_frameNumber;
+
+    frame.number = _frameNumber;
+    frame.scene = scene;
+    scene->bvh.Update(scene->objects);
+
+    // shadow maps render into buffers the frame in flight isn't sampling,
+    // and the light clusters are per frame, so this can overlap with it
+    scene->lightClusters = frame.lightClusters;
+    DrawShadowMaps(scene);
+    frame.lightClusters->Build(*scene->camera, scene->lights);
+
+    // in the order of the scene's objects
+    _visibleObjects.clear();
+    scene->bvh.Cull(scene->camera->GetFrustumPlanes(), 6, _visibleObjects);
+
+    // instances are culled up front, since each one gets a draw call
+    _visibleInstances.clear();
+    _visibleInstanceEnds.clear();
+
+    for(auto& obj : scene->instancedObjects)
+    {
+        if(obj->model->GetVertexCount(0) > 0)
+            obj->Cull(scene->camera->GetFrustumPlanes(), 6, _visibleInstances);
+
+        _visibleInstanceEnds.push_back(_visibleInstances.size());
+    }
+
+    frame.drawCalls = frame.arena.Allocate<DrawCall>(_visibleObjects.size() + _visibleInstances.size());
+    frame.drawCallCount = 0;
+    frame.batchCount = 0;
+    frame.pendingBatchCount = 0;
+
+    for(uint32_t index : _visibleObjects)
+    {
+        const shared_ptr<SceneObject>& obj = scene->objects[index];
+        const Model& model = *obj->model;
+        if(model.GetVertexCount(0) == 0)
+            continue;
+
+        // lightmaps are laid out over the full model
+        obj->lod = obj->lightmap ? 0 : model.SelectLOD(scene->camera->GetScreenSize(scene->bvh.GetSphere(index)), obj->lod);
+        const Vertex* vertices = model.packed() ? nullptr : model.GetVertices(obj->lod).data();
+        const PackedVertex* packedVertices = model.packed() ? model.packedLods[obj->lod].data() : nullptr;
+        size_t vertCount = model.GetVertexCount(obj->lod);
+
+        DrawState& state = obj->drawStates[slot];
+        Shader* shader = PrepareShader(*scene, *obj, state);
+
+        bool fillCache = false;
+        VertexCache* cache = FindVertexCache(frame, obj, state, fillCache);
+
+        // the batch range is set once the batches are laid out below.
+        // cached geometry is drawn as a single batch.
+        DrawCall& drawCall = frame.drawCalls[frame.drawCallCount++];
+        drawCall = DrawCall{
+            0, 1, obj.get(), nullptr, nullptr, vertices, packedVertices, &model.quantization, vertCount, nullptr, obj->texture.get(),
+            shader, obj->cullMode, cache, fillCache, Rect(0, 0, 0, 0)
+        };
+
+        if(!cache || fillCache)
+        {
+            drawCall.lastBatch = CullMeshlets(frame, drawCall, model, obj->lod, obj->transform.GetMatrix(), *scene->camera);
+            frame.pendingBatchCount += drawCall.lastBatch;
+        }
+
+        frame.batchCount += drawCall.lastBatch;
+    }
+
+    // after the scene objects, in the order of the instanced objects
+    const Mat4& mtxVP = scene->camera->GetVPMatrix();
+    size_t nextInstance = 0;
+
+    for(size_t i = 0; i < scene->instancedObjects.size(); ++i)
+    {
+        InstancedObject* obj = scene->instancedObjects[i].get();
+        size_t end = _visibleInstanceEnds[i];
+        if(nextInstance == end)
+            continue;
+
+        // prepared once for all of the instances, which only differ by their matrices
+        DrawState& state = obj->drawStates[slot];
+        Shader* shader = PrepareShader(*scene, *obj, state);
+
+        InstanceData* instances = frame.arena.Allocate<InstanceData>(end - nextInstance);
+
+        for(InstanceData* instance = instances; nextInstance < end; ++nextInstance, ++instance)
+        {
+            uint32_t index = _visibleInstances[nextInstance];
+            int lod = obj->SelectLOD(index, *scene->camera);
+            const Model& model = *obj->model;
+            instance->mtxModel = obj->GetMatrix(index);
+            instance->mtxMVP = instance->mtxModel * mtxVP;
+            instance->mtxNormal = obj->GetNormalMatrix(index);
+            instance->parameters = obj->GetParameters(index);
+
+            DrawCall& drawCall = frame.drawCalls[frame.drawCallCount++];
+            drawCall = DrawCall{
+                0, 0, nullptr, obj, instance, model.packed() ? nullptr : model.GetVertices(lod).data(),
+                model.packed() ? model.packedLods[lod].data() : nullptr, &model.quantization, model.GetVertexCount(lod), nullptr, obj->texture.get(),
+                shader, obj->cullMode, nullptr, false, Rect(0, 0, 0, 0)
+            };
+
+            drawCall.lastBatch = CullMeshlets(frame, drawCall, model, lod, instance->mtxModel, *scene->camera);
+            frame.batchCount += drawCall.lastBatch;
+            frame.pendingBatchCount += drawCall.lastBatch;
+        }
+    }
+
+    frame.batches = frame.arena.Allocate<GeometryBatch>(frame.batchCount);
+
+    // the batches that need processing go first, and the cached ones after them.
+    // the order doesn't matter otherwise, since they're rasterized by draw call.
+    size_t nextPending = 0;
+    size_t nextCached = frame.pendingBatchCount;
+
+    for(size_t d = 0; d < frame.drawCallCount; ++d)
+    {
+        DrawCall& drawCall = frame.drawCalls[d];
+        size_t vertCount = drawCall.vertexCount;
+        size_t batchCount = drawCall.lastBatch;
+
+        if(drawCall.cache && !drawCall.fillCache)
+        {
+            auto& verts = drawCall.cache->verts;
+            drawCall.firstBatch = nextCached;
+            frame.batches[nextCached++] = GeometryBatch{ d, 0, vertCount, verts.data(), verts.size(), drawCall.cache->bounds };
+        }
+        else
+        {
+            drawCall.firstBatch = nextPending;
+
+            for(size_t i = 0; i < batchCount; ++i)
+            {
+                const VertexRange& range = drawCall.ranges[i];
+                frame.batches[nextPending++] = GeometryBatch{ d, range.first, range.last, nullptr, 0, Rect(0, 0, 0, 0) };
+            }
+        }
+
+        drawCall.lastBatch = drawCall.firstBatch + batchCount;
+    }
+
+    // a job per thread, each taking batches until there are none left and
+    // writing their triangles into an arena that no other job touches
+    frame.nextBatch = 0;
+    size_t jobCount = min(frame.geometryArenas.size(), frame.pendingBatchCount);
+
+    _jobSystem->ParallelFor(jobCount, [this, &frame](size_t i)
+    {
+        Arena& arena = *frame.geometryArenas[i];
+
+        for(size_t b = frame.nextBatch++; b < frame.pendingBatchCount; b = frame.nextBatch++)
+            ProcessGeometry(frame, frame.batches[b], arena);
+    }, _jobGroup);
+
+    for(size_t d = 0; d < frame.drawCallCount; ++d)
+    {
+        DrawCall& drawCall = frame.drawCalls[d];
+
+        for(size_t b = drawCall.firstBatch; b < drawCall.lastBatch; ++b)
+            drawCall.bounds = Rect::Union(drawCall.bounds, frame.batches[b].bounds);
+
+        if(drawCall.fillCache)
+            FillVertexCache(frame, drawCall);
+    }
+
+    // the color and depth buffers are shared, so rasterization waits for the previous frame
+    Flush();
+
+    frame.clearColor = _clearColorPending;
+    frame.clearDepth = _clearDepthPending;
+    _clearColorPending = false;
+    _clearDepthPending = false;
+
+    // only the parts of the screen that changed are rendered again, over a copy of the last frame
+    if(_incrementalRendering && frame.clearColor && frame.clearDepth)
+    {
+        frame.incremental = _dirtyTiles.Update(*scene, frame.drawCalls, frame.drawCallCount,
+            (int)_width, (int)_height, (int)_renderWidth, (int)_renderHeight, frame.strips);
+    }
+    else
+    {
+        _dirtyTiles.Invalidate();
+        frame.incremental = false;
+    }
+
+    // otherwise strips of equal cost, going by the timings of the frames so far
+    if(!frame.incremental)
+        SplitByCost(_renderWidth, _renderHeight, frame.strips);
+
+    frame.stripTimes.resize(frame.strips.size());
+
+    if(_maxFramesInFlight > 1)
+    {
+        frame.rasterJob = _jobSystem->Schedule([this, &frame]{ RasterizeFrame(frame); }, _jobGroup);
+        _rasterizingFrame = &frame;
+    }
+    else
+    {
+        RasterizeFrame(frame);
+        EndFrame(frame);
+    }
+}
+
+Shader* RenderingContext::PrepareShader(Scene& scene, SceneObject& obj, DrawState& state)
+{
+    const Camera& camera = *scene.camera;
+    const Shader* source = obj.shader.get();
+
+    // the object's copy has to be replaced when its shader or the shader's settings change
+    if(state.source != source || state.sourceVersion != source->version())
+    {
+        state.shader = source->Clone();
+        state.source = source;
+        state.sourceVersion = source->version();
+        state.scene = nullptr;
+    }
+
+    // light clusters are built again every frame, and a copy whose vertices depend
+    // on the lights, like a vertex lit one, gathers them again
+    bool changed = state.scene != &scene
+                || state.camera != &camera
+                || state.cameraVersion != camera.GetVersion()
+                || state.transformVersion != obj.transform.GetVersion()
+                || state.texture != obj.texture.get()
+                || state.lightmap != obj.lightmap.get()
+                || state.lightClusters != scene.lightClusters.get()
+                || !state.shader->cacheableVertices();
+
+    if(changed)
+    {
+        state.shader->Prepare(&scene, &obj);
+        state.scene = &scene;
+        state.camera = &camera;
+        state.cameraVersion = camera.GetVersion();
+        state.transformVersion = obj.transform.GetVersion();
+        state.texture = obj.texture.get();
+        state.lightmap = obj.lightmap.get();
+        state.lightClusters = scene.lightClusters.get();
+        ++state.version;
+    }
+
+    return state.shader.get();
+}
+
+Shader* RenderingContext::PrepareShader(Scene& scene, InstancedObject& obj, DrawState& state)
+{
+    const Camera& camera = *scene.camera;
+    const Shader* source = obj.shader.get();
+
+    if(state.source != source || state.sourceVersion != source->version())
+    {
+        state.shader = source->Clone();
+        state.source = source;
+        state.sourceVersion = source->version();
+        state.scene = nullptr;
+    }
+
+    // the instances' transforms aren't part of it, they're given to the shader per instance
+    bool changed = state.scene != &scene
+                || state.camera != &camera
+                || state.cameraVersion != camera.GetVersion()
+                || state.texture != obj.texture.get()
+                || state.lightClusters != scene.lightClusters.get();
+
+    if(changed)
+    {
+        if(!state.shader->PrepareInstanced(&scene, &obj))
+            throw runtime_error("The shader of '" + obj.name + "' can't draw instances.");
+
+        state.scene = &scene;
+        state.camera = &camera;
+        state.cameraVersion = camera.GetVersion();
+        state.texture = obj.texture.get();
+        state.lightClusters = scene.lightClusters.get();
+        ++state.version;
+    }
+
+    return state.shader.get();
+}
+
+VertexCache* RenderingContext::FindVertexCache(Frame& frame, const shared_ptr<SceneObject>& obj, const DrawState& state, bool& fill)
+{
+    fill = false;
+
+    if(_vertexCacheSize == 0 || !state.shader->cacheableVertices())
+        return nullptr;
+
+    VertexCache& cache = frame.vertexCaches[obj.get()];
+    uint32_t modelVersion = obj->model->GetVersion();
+
+    bool same = !cache.owner.expired()
+             && cache.stateVersion == state.version
+             && cache.model == obj->model.get()
+             && cache.modelVersion == modelVersion
+             && cache.lod == obj->lod
+             && cache.renderWidth == _renderWidth
+             && cache.renderHeight == _renderHeight;
+
+    cache.lastDrawn = _frameNumber;
+
+    if(!same)
+    {
+        // objects that keep moving would only churn the cache, so the
+        // geometry is kept once nothing has changed since the last time
+        ReleaseVertexCache(cache);
+        cache.owner = obj;
+        cache.stateVersion = state.version;
+        cache.model = obj->model.get();
+        cache.modelVersion = modelVersion;
+        cache.lod = obj->lod;
+        cache.renderWidth = _renderWidth;
+        cache.renderHeight = _renderHeight;
+        return nullptr;
+    }
+
+    fill = !cache.filled;
+    return &cache;
+}
+
+void RenderingContext::FillVertexCache(Frame& frame, const DrawCall& drawCall)
+{
+    VertexCache& cache = *drawCall.cache;
+
+    size_t vertCount = 0;
+    for(size_t b = drawCall.firstBatch; b < drawCall.lastBatch; ++b)
+        vertCount += frame.batches[b].vertCount;
+
+    size_t size = vertCount * sizeof(Vertex);
+
+    // make room by dropping the geometry of objects that weren't drawn this frame. the
+    // other frame's caches are left alone, since it may still be rasterizing from them.
+    for(auto it = frame.vertexCaches.begin(); it != frame.vertexCaches.end() && _vertexCacheUsed + size > _vertexCacheSize; )
+    {
+        if(it->second.lastDrawn != _frameNumber)
+        {
+            ReleaseVertexCache(it->second);
+            it = frame.vertexCaches.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // without room, it's tried again the next time the object is drawn
+    if(_vertexCacheUsed + size > _vertexCacheSize)
+        return;
+
+    cache.verts.reserve(vertCount);
+
+    for(size_t b = drawCall.firstBatch; b < drawCall.lastBatch; ++b)
+    {
+        const GeometryBatch& batch = frame.batches[b];
+        cache.verts.insert(cache.verts.end(), batch.verts, batch.verts + batch.vertCount);
+    }
+
+    cache.bounds = drawCall.bounds;
+    cache.filled = true;
+    _vertexCacheUsed += cache.verts.capacity() * sizeof(Vertex);
+}
+
+void RenderingContext::ReleaseVertexCache(VertexCache& cache)
+{
+    _vertexCacheUsed -= cache.verts.capacity() * sizeof(Vertex);
+    vector<Vertex, AlignedAllocator<Vertex, 16>>().swap(cache.verts);
+    cache.filled = false;
+}
+
+void RenderingContext::ClearVertexCaches()
+{
+    for(auto& frame : _frames)
+    {
+        for(auto& entry : frame.vertexCaches)
+            ReleaseVertexCache(entry.second);
+
+        frame.vertexCaches.clear();
+    }
+}
+
+void RenderingContext::Flush()
+{
+    if(!_rasterizingFrame)
+        return;
 
-    for(auto obj : scene->objects)
+    Frame& frame = *_rasterizingFrame;
+    _rasterizingFrame = nullptr;
+
+    shared_ptr<Job> job = move(frame.rasterJob);
+    _jobSystem->Wait(job);
+
+    EndFrame(frame);
+}
+
+void RenderingContext::RasterizeFrame(Frame& frame)
+{
+    if(frame.incremental)
     {
-        if(scene->camera->CanSee(obj->GetWorldBoundingSphere()))
+        // the buffers alternate, so the last frame is copied from the one it was presented from.
+        // the depth buffer and the samples of the antialiasing buffer are still the last frame's.
+        memcpy(_colorBuffer.data(), _presentBuffer.data(), _width * _height * sizeof(uint32_t));
+
+        _jobSystem->ParallelFor(frame.strips.size(), [this, &frame](size_t i)
         {
-            obj->shader->Prepare(scene.get(), obj.get());
+            auto start = chrono::steady_clock::now();
+
+            ClearRect(frame.strips[i]);
+            RasterizeStrip(frame, frame.strips[i]);
+            Resolve(frame.strips[i]);
+
+            frame.stripTimes[i] = chrono::duration<float>(chrono::steady_clock::now() - start).count();
+        }, _jobGroup);
+
+        return;
+    }
+
+    bool resolvesInPlace = _antiAliasingMode == AntiAliasingMode::Off
+        || (_antiAliasingMode == AntiAliasingMode::MSAA_4X && _rasterizationMode == RasterizationMode::Scanline);
+
+    if(frame.clearColor)
+    {
+        if(resolvesInPlace)
+            _colorBuffer.Fill(_clearColor);
+        else
+            _aaBuffer.Fill(_clearColor);
+    }
+    else if(resolvesInPlace)
+    {
+        // drawing over the last frame. the buffer being rendered into was presented two frames ago.
+        memcpy(_colorBuffer.data(), _presentBuffer.data(), _width * _height * sizeof(uint32_t));
+    }
+
+    if(frame.clearDepth)
+        _depthBuffer.Fill(0);
+
+    _jobSystem->ParallelFor(frame.strips.size(), [this, &frame](size_t i)
+    {
+        auto start = chrono::steady_clock::now();
+
+        RasterizeStrip(frame, frame.strips[i]);
+        Resolve(frame.strips[i]);
+
+        frame.stripTimes[i] = chrono::duration<float>(chrono::steady_clock::now() - start).count();
+    }, _jobGroup);
+}
+
+void RenderingContext::EndFrame(Frame& frame)
+{
+    // the costs are measured over whole rows, which incremental frames don't render
+    if(!frame.incremental)
+        UpdateCosts(frame);
+
+    swap(_colorBuffer, _presentBuffer);
+    _finishedFrameNumber = frame.number;
+
+    frame.drawCalls = nullptr;
+    frame.drawCallCount = 0;
+    frame.batches = nullptr;
+    frame.batchCount = 0;
+    frame.pendingBatchCount = 0;
+    frame.arena.Reset();
+
+    // which job ends up with which batches changes from frame to frame, so each arena
+    // keeps room for all of the frame's triangles. otherwise one of them could still
+    // grow long after the frames stopped changing.
+    size_t geometrySize = 0;
+    for(auto& arena : frame.geometryArenas)
+        geometrySize += arena->used();
+
+    for(auto& arena : frame.geometryArenas)
+    {
+        arena->Reset();
+        arena->Reserve(geometrySize);
+    }
+
+    frame.scene.reset();
+}
+
+void RenderingContext::SplitRows(int width, int height, vector<Rect>& strips) const
+{
+    size_t count = _jobSystem->threadCount() * StripsPerThread;
+    int rows = Math::Max((height + (int)count - 1) / (int)count, 1);
 
-            if(obj->model->vertices.empty())
+    strips.clear();
+
+    for(int y = 0; y < height; y += rows)
+        strips.push_back(Rect(0, y, width, Math::Min(rows, height - y)));
+}
+
+void RenderingContext::SplitByCost(int width, int height, vector<Rect>& strips)
+{
+    int bandCount = (height + CostBandHeight - 1) / CostBandHeight;
+
+    // nothing measured yet after a resolution change, so split evenly
+    if(_bandCosts.size() != (size_t)bandCount)
+        _bandCosts.assign(bandCount, 0.0f);
+
+    float total = 0;
+    for(auto cost : _bandCosts)
+        total += cost;
+
+    bool even = total <= 0;
+    if(even)
+        total = (float)bandCount;
+
+    int count = (int)Math::Min(_jobSystem->threadCount() * StripsPerThread, (size_t)bandCount);
+    float target = total / (float)count;
+    float sum = 0;
+    int firstBand = 0;
+
+    strips.clear();
+
+    for(int b = 0; b < bandCount; ++b)
+    {
+        sum += even ? 1.0f : _bandCosts[b];
+
+        int stripsLeft = count - (int)strips.size() - 1;
+        int bandsLeft = bandCount - b - 1;
+
+        // close the strip once it has its share of the cost, keeping
+        // at least one band for each of the strips still to come
+        if(b == bandCount - 1
+        || (stripsLeft > 0 && (sum >= target * (float)(strips.size() + 1) || bandsLeft == stripsLeft)))
+        {
+            int y0 = firstBand * CostBandHeight;
+            int y1 = Math::Min((b + 1) * CostBandHeight, height);
+            strips.push_back(Rect(0, y0, width, y1 - y0));
+            firstBand = b + 1;
+        }
+    }
+}
+
+void RenderingContext::UpdateCosts(const Frame& frame)
+{
+    int bandCount = (int)_bandCosts.size();
+
+    for(size_t i = 0; i < frame.strips.size(); ++i)
+    {
+        const Rect& rect = frame.strips[i];
+        int b0 = rect.y / CostBandHeight;
+        int b1 = Math::Min((rect.y + rect.h + CostBandHeight - 1) / CostBandHeight, bandCount);
+        if(b0 >= b1)
+            continue;
+
+        // the time is spread evenly over the strip's bands, which
+        // the following frames refine as the strips move around
+        float cost = frame.stripTimes[i] / (float)(b1 - b0);
+
+        for(int b = b0; b < b1; ++b)
+            _bandCosts[b] = _bandCosts[b] > 0 ? Math::Lerp(_bandCosts[b], cost, CostSmoothing) : cost;
+    }
+}
+
+size_t RenderingContext::CullMeshlets(Frame& frame, DrawCall& drawCall, const Model& model, int lod, const Mat4& mtxModel, const Camera& camera)
+{
+    size_t vertCount = drawCall.vertexCount;
+    size_t meshletCount = lod < (int)model.meshlets.size() ? model.meshlets[lod].size() : 0;
+
+    // without meshlets, the vertices are split into batches evenly
+    if(meshletCount == 0)
+    {
+        size_t batchCount = (vertCount + BatchSize - 1) / BatchSize;
+        VertexRange* ranges = frame.arena.Allocate<VertexRange>(batchCount);
+
+        for(size_t i = 0; i < batchCount; ++i)
+            ranges[i] = VertexRange{ i * BatchSize, min((i + 1) * BatchSize, vertCount) };
+
+        drawCall.ranges = ranges;
+        return batchCount;
+    }
+
+    // the frustum and the eye are brought into model space, where the meshlets are.
+    // (p * M) . P = p . (M * P), so the planes are transformed by the rows of the matrix.
+    const Mat4& m = mtxModel;
+    const Plane* frustum = camera.GetFrustumPlanes();
+    Plane planes[6];
+
+    for(int p = 0; p < 6; ++p)
+    {
+        const Plane& f = frustum[p];
+        planes[p] = Plane(m.m11 * f.a + m.m12 * f.b + m.m13 * f.c + m.m14 * f.d,
+                          m.m21 * f.a + m.m22 * f.b + m.m23 * f.c + m.m24 * f.d,
+                          m.m31 * f.a + m.m32 * f.b + m.m33 * f.c + m.m34 * f.d,
+                          m.m41 * f.a + m.m42 * f.b + m.m43 * f.c + m.m44 * f.d);
+        planes[p].Normalize();
+    }
+
+    Vec3 eye = Vec4(camera.transform.GetPosition(), 1.0f) * m.Inverse();
+
+    // a triangle faces away from the camera when its normal points at the eye.
+    // a mirroring matrix turns the triangles around, and front face culling looks at the other side.
+    Vec3 r1(m.m11, m.m12, m.m13);
+    Vec3 r2(m.m21, m.m22, m.m23);
+    Vec3 r3(m.m31, m.m32, m.m33);
+    float facing = r1.Dot(r2.Cross(r3)) < 0.0f ? -1.0f : 1.0f;
+    if(drawCall.cullMode == CullMode::Front)
+        facing = -facing;
+
+    const Meshlet* meshlets = model.meshlets[lod].data();
+    VertexRange* ranges = frame.arena.Allocate<VertexRange>(meshletCount);
+    size_t rangeCount = 0;
+
+    for(size_t i = 0; i < meshletCount; ++i)
+    {
+        const Meshlet& meshlet = meshlets[i];
+        const Sphere& bounds = meshlet.bounds;
+
+        bool visible = true;
+        for(int p = 0; p < 6 && visible; ++p)
+            visible = !planes[p].InBack(bounds);
+
+        if(!visible)
+            continue;
+
+        // the normals closest to facing the camera, from the points of the sphere closest to it
+        if(drawCall.cullMode != CullMode::None && meshlet.coneCos > 0.0f)
+        {
+            Vec3 toEye = eye - bounds.center;
+            float along = meshlet.coneAxis.Dot(toEye) * facing;
+            float across = sqrt(max(toEye.LengthSq() - along * along, 0.0f));
+
+            if(meshlet.coneCos * along - meshlet.coneSin * across > bounds.radius)
                 continue;
-            
-            size_t sz = obj->model->vertices.size();
+        }
 
-            _xverts.reserve(sz);
+        size_t first = meshlet.first;
+        size_t last = first + meshlet.count;
 
-            for(auto& v : obj->model->vertices)
-                _xverts.push_back(obj->shader->ProcessVertex(v));
-            
-            size_t start = _cverts.size();
-            _cverts.reserve(start + _xverts.size());
+        // neighbours are processed together, up to a batch
+        if(rangeCount > 0 && ranges[rangeCount - 1].last == first && last - ranges[rangeCount - 1].first <= BatchSize)
+            ranges[rangeCount - 1].last = last;
+        else
+            ranges[rangeCount++] = VertexRange{ first, last };
+    }
 
-            for(auto it = _xverts.begin(); it != _xverts.end(); )
+    drawCall.ranges = ranges;
+    return rangeCount;
+}
+
+void RenderingContext::ProcessGeometry(const Frame& frame, GeometryBatch& batch, Arena& arena)
+{
+    const DrawCall& drawCall = frame.drawCalls[batch.drawCall];
+    Shader* shader = drawCall.shader;
+    const InstanceData* instance = drawCall.instance;
+    const Vertex* vertices = drawCall.vertices;
+    const PackedVertex* packedVertices = drawCall.packedVertices;
+
+    // the packed vertices ahead are unpacked here, a few triangles at a time
+    Vertex unpacked[UnpackSize];
+    size_t unpackedFirst = batch.first;
+    size_t unpackedLast = batch.first;
+
+    // room for every triangle coming out whole, which clipping rarely exceeds.
+    // the batch is the arena's last allocation, so it grows and shrinks in place.
+    size_t capacity = batch.last - batch.first;
+    batch.verts = arena.Allocate<Vertex>(capacity);
+    batch.vertCount = 0;
+
+    float minX = FLT_MAX, minY = FLT_MAX;
+    float maxX = -FLT_MAX, maxY = -FLT_MAX;
+
+    for(size_t v = batch.first; v < batch.last; v += 3)
+    {
+        // clip near/far planes
+        const Vertex* in;
+        if(packedVertices)
+        {
+            if(v == unpackedLast)
             {
-                // clip near/far planes
-                Vertex tmp[9];
-                tmp[0] = *it++;
-                tmp[1] = *it++;
-                tmp[2] = *it++;
+                unpackedFirst = v;
+                unpackedLast = min(v + UnpackSize, batch.last);
+                PackedVertex::Unpack(packedVertices + v, unpackedLast - v, *drawCall.quantization, unpacked);
+            }
+
+            in = unpacked + (v - unpackedFirst);
+        }
+        else
+        {
+            in = vertices + v;
+        }
 
-                int nVerts = 3;
+        Vertex tmp[9];
+        if(instance)
+        {
+            tmp[0] = shader->ProcessVertex(in[0], *instance);
+            tmp[1] = shader->ProcessVertex(in[1], *instance);
+            tmp[2] = shader->ProcessVertex(in[2], *instance);
+        }
+        else
+        {
+            tmp[0] = shader->ProcessVertex(in[0]);
+            tmp[1] = shader->ProcessVertex(in[1]);
+            tmp[2] = shader->ProcessVertex(in[2]);
+        }
 
-                nVerts = ClipDepth(tmp, nVerts);
-                if(nVerts < 3)
-                    continue;
+        int nVerts = 3;
 
-                for(int i = 0; i < nVerts; ++i)
-                {
-                    // perspective divide -> normalized device coordinates
-                    float zr = 1.0f / tmp[i].position.w;
-                    tmp[i] *= zr;
-                    tmp[i].position.w = zr;
-
-                    // viewport transformation -> screen space
-                    tmp[i].position.x = (tmp[i].position.x + 1.0f) * 0.5f * (float)_renderWidth;
-                    tmp[i].position.y = (tmp[i].position.y + 1.0f) * 0.5f * (float)_renderHeight;
-                    tmp[i].position.y = (float)_renderHeight - tmp[i].position.y;
-                }
+        nVerts = ClipDepth(tmp, nVerts);
+        if(nVerts < 3)
+            continue;
 
-                nVerts = ClipScreen(tmp, nVerts);
-                if(nVerts < 3)
-                    continue;
+        for(int i = 0; i < nVerts; ++i)
+        {
+            // perspective divide -> normalized device coordinates
+            float zr = 1.0f / tmp[i].position.w;
+            tmp[i] *= zr;
+            tmp[i].position.w = zr;
+
+            // viewport transformation -> screen space
+            tmp[i].position.x = (tmp[i].position.x + 1.0f) * 0.5f * (float)_renderWidth;
+            tmp[i].position.y = (tmp[i].position.y + 1.0f) * 0.5f * (float)_renderHeight;
+            tmp[i].position.y = (float)_renderHeight - tmp[i].position.y;
+        }
 
-                for(int i = 1; i < nVerts - 1; i++)
-                {
-                    _cverts.push_back(tmp[0]);
-                    _cverts.push_back(tmp[i]);
-                    _cverts.push_back(tmp[i + 1]);
-                }
+        nVerts = ClipScreen(tmp, nVerts);
+        if(nVerts < 3)
+            continue;
+
+        size_t needed = batch.vertCount + (nVerts - 2) * 3;
+        if(needed > capacity)
+        {
+            size_t grown = max(capacity * 2, needed);
+            batch.verts = (Vertex*)arena.Reallocate(batch.verts, capacity * sizeof(Vertex), grown * sizeof(Vertex));
+            capacity = grown;
+        }
+
+        for(int i = 1; i < nVerts - 1; i++)
+        {
+            batch.verts[batch.vertCount++] = tmp[0];
+            batch.verts[batch.vertCount++] = tmp[i];
+            batch.verts[batch.vertCount++] = tmp[i + 1];
+        }
+
+        for(int i = 0; i < nVerts; ++i)
+        {
+            minX = Math::Min(minX, tmp[i].position.x);
+            minY = Math::Min(minY, tmp[i].position.y);
+            maxX = Math::Max(maxX, tmp[i].position.x);
+            maxY = Math::Max(maxY, tmp[i].position.y);
+        }
+    }
+
+    if(batch.vertCount > 0)
+    {
+        int x0 = Math::Floor(minX);
+        int y0 = Math::Floor(minY);
+        batch.bounds = Rect(x0, y0, Math::Ceil(maxX) - x0 + 1, Math::Ceil(maxY) - y0 + 1);
+    }
+    else
+    {
+        batch.bounds = Rect(0, 0, 0, 0);
+    }
+
+    // give the unused space back to the next batch
+    arena.Reallocate(batch.verts, capacity * sizeof(Vertex), batch.vertCount * sizeof(Vertex));
+}
+
+void RenderingContext::RasterizeStrip(Frame& frame, const Rect& rect)
+{
+    for(size_t d = 0; d < frame.drawCallCount; ++d)
+    {
+        DrawCall& drawCall = frame.drawCalls[d];
+        if(!drawCall.bounds.Intersects(rect))
+            continue;
+
+        for(size_t b = drawCall.firstBatch; b < drawCall.lastBatch; ++b)
+        {
+            const GeometryBatch& batch = frame.batches[b];
+            if(!batch.bounds.Intersects(rect))
+                continue;
+
+            for(size_t i = 0; i < batch.vertCount; i += 3)
+                Rasterize(rect, batch.verts[i], batch.verts[i + 1], batch.verts[i + 2], &drawCall);
+        }
+    }
+}
+
+void RenderingContext::ClearRect(const Rect& rect)
+{
+    // the buffers keep the samples of a pixel together, so the
+    // rect is cleared as the pixels of the final image it covers
+    int scale = _renderWidth / _width;
+    int x = rect.x / scale;
+    int y = rect.y / scale;
+    int w = rect.w / scale;
+    int h = rect.h / scale;
+
+    if(_antiAliasingMode == AntiAliasingMode::Off
+    || (_antiAliasingMode == AntiAliasingMode::MSAA_4X && _rasterizationMode == RasterizationMode::Scanline))
+        _colorBuffer.Fill(x, y, w, h, _clearColor);
+    else
+        _aaBuffer.Fill(x, y, w, h, _clearColor);
+
+    _depthBuffer.Fill(x, y, w, h, 0);
+}
+
+void RenderingContext::DrawShadowMaps(const shared_ptr<Scene>& scene)
+{
+    for(auto& light : scene->lights)
+    {
+        LightType type = light->type();
+
+        if(type == LightType::Directional)
+        {
+            auto directional = (DirectionalLight*)light.get();
+            if(!directional->castShadows)
+                continue;
+
+            directional->shadowMap.Update(*scene->camera, directional->direction);
+
+            for(auto& cascade : directional->shadowMap.cascades)
+            {
+                if(cascade.UpdateCasters(*scene))
+                    DrawShadowMap(cascade);
             }
+        }
+        else if(type == LightType::Spot)
+        {
+            auto spot = (SpotLight*)light.get();
+            if(!spot->castShadows)
+                continue;
 
-            _xverts.clear();
-            size_t end = _cverts.size();
-            obj->shader->CopyTo(_shaders);
+            spot->UpdateShadowMap();
 
-            _drawCalls.push_back({ start, end, obj.get(), nullptr });
+            if(spot->shadowMap.UpdateCasters(*scene))
+                DrawShadowMap(spot->shadowMap);
         }
     }
-    
-    auto st = _shaders.begin();
-    for(auto it = _drawCalls.begin(); it != _drawCalls.end(); ++it, ++st) {
-        it->shader = *st;
+}
+
+void RenderingContext::DrawShadowMap(ShadowMap& shadowMap)
+{
+    const Mat4& mtxVP = shadowMap.GetVPMatrix();
+    float size = (float)shadowMap.size();
+
+    for(auto obj : shadowMap.GetCasters())
+        AddShadowCaster(*obj->model, obj->transform.GetMatrix() * mtxVP, size);
+
+    auto& instances = shadowMap.GetCasterInstances();
+
+    for(auto& caster : shadowMap.GetInstancedCasters())
+    {
+        for(size_t i = caster.first; i < caster.last; ++i)
+            AddShadowCaster(*caster.obj->model, caster.obj->GetMatrix(instances[i]) * mtxVP, size);
+    }
+
+    SplitRows((int)size, (int)size, _shadowStrips);
+
+    _jobSystem->ParallelFor(_shadowStrips.size(), [&](size_t i) {
+        RasterizeShadowMap(shadowMap, _shadowStrips[i]);
+    }, _jobGroup);
+
+    _shadowVerts.clear();
+}
+
+void RenderingContext::AddShadowCaster(const Model& model, const Mat4& mtxMVP, float size)
+{
+    if(!model.packed())
+    {
+        AddShadowTriangles(model.vertices.data(), model.vertices.size(), mtxMVP, size);
+        return;
+    }
+
+    auto& packedVertices = model.packedLods[0];
+    Vertex unpacked[UnpackSize];
+
+    for(size_t first = 0; first < packedVertices.size(); first += UnpackSize)
+    {
+        size_t count = min(first + UnpackSize, packedVertices.size()) - first;
+        PackedVertex::Unpack(packedVertices.data() + first, count, model.quantization, unpacked);
+        AddShadowTriangles(unpacked, count, mtxMVP, size);
     }
+}
+
+void RenderingContext::AddShadowTriangles(const Vertex* vertices, size_t count, const Mat4& mtxMVP, float size)
+{
+    for(const Vertex* it = vertices; it != vertices + count; )
+    {
+        // only positions are needed, the other attributes are zeroed
+        Vertex tmp[9];
+        tmp[0] = Vertex(Vec4((it++)->position, 1.0f) * mtxMVP, Vec3::zero, Vec2::zero, Vec3::zero);
+        tmp[1] = Vertex(Vec4((it++)->position, 1.0f) * mtxMVP, Vec3::zero, Vec2::zero, Vec3::zero);
+        tmp[2] = Vertex(Vec4((it++)->position, 1.0f) * mtxMVP, Vec3::zero, Vec2::zero, Vec3::zero);
+
+        int nVerts = ClipDepth(tmp, 3);
+        if(nVerts < 3)
+            continue;
+
+        Vec4 sv[9];
 
-    size_t threadCount = _renderThreads.size();
-    int segment = _renderHeight / threadCount;
-    int lastseg = _renderHeight - segment * (threadCount - 1);
+        for(int i = 0; i < nVerts; ++i)
+        {
+            // perspective divide and viewport transformation, z is kept as z/w
+            const Vec4& p = tmp[i].position;
+            float zr = 1.0f / p.w;
+            sv[i].x = (p.x * zr + 1.0f) * 0.5f * size;
+            sv[i].y = size - (p.y * zr + 1.0f) * 0.5f * size;
+            sv[i].z = p.z * zr;
+            sv[i].w = 1.0f;
+        }
 
-    size_t i = 0;
-    for( ; i < threadCount - 1; ++i)
-        _renderThreads[i]->Execute(this, Rect(0, segment * i, _renderWidth, segment));
+        for(int i = 1; i < nVerts - 1; i++)
+        {
+            _shadowVerts.push_back(sv[0]);
+            _shadowVerts.push_back(sv[i]);
+            _shadowVerts.push_back(sv[i + 1]);
+        }
+    }
+}
 
-    if(i < threadCount)
-        _renderThreads[i]->Execute(this, Rect(0, segment * i, _renderWidth, lastseg));
+void RenderingContext::RasterizeShadowMap(ShadowMap& shadowMap, const Rect& rect)
+{
+    RenderBuffer<float>& depthBuffer = shadowMap.depthBuffer();
 
-    for(size_t j = 0; j < threadCount; ++j)
-        _renderThreads[j]->Wait();
+    float* rows = depthBuffer.data() + rect.y * depthBuffer.width();
+    fill(rows, rows + rect.h * depthBuffer.width(), 1.0f);
 
-    _drawCalls.clear();
-    _shaders.clear();
-    _cverts.clear();
+    for(size_t i = 0; i < _shadowVerts.size(); i += 3)
+        RasterizeDepth(depthBuffer, rect, _shadowVerts[i], _shadowVerts[i + 1], _shadowVerts[i + 2]);
+}
+
+void RenderingContext::RasterizeDepth(RenderBuffer<float>& depthBuffer, const Rect& rect, const Vec4& v0, const Vec4& v1, const Vec4& v2)
+{
+    // clamp before converting, since shadow casters aren't clipped to the sides of the map
+    float left = (float)rect.x;
+    float right = (float)(rect.x + rect.w);
+    float top = (float)rect.y;
+    float bottom = (float)(rect.y + rect.h);
+
+    int minx = Math::Floor(Math::Clamp(Math::Min(v0.x, v1.x, v2.x), left, right));
+    int maxx = Math::Ceil(Math::Clamp(Math::Max(v0.x, v1.x, v2.x), left, right));
+    int miny = Math::Floor(Math::Clamp(Math::Min(v0.y, v1.y, v2.y), top, bottom));
+    int maxy = Math::Ceil(Math::Clamp(Math::Max(v0.y, v1.y, v2.y), top, bottom));
+
+    if(maxx - minx < 1 || maxy - miny < 1)
+        return;
+
+    float area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+    if(abs(area) < FLT_EPSILON)
+        return;
+
+    // casters are drawn double sided, so orient the edge functions
+    // to be positive on the inside regardless of winding
+    float sign = area > 0 ? -1.0f : 1.0f;
+    float invArea = 1.0f / abs(area);
+
+    Vec3 Dx(sign * (v2.y - v1.y),
+            sign * (v0.y - v2.y),
+            sign * (v1.y - v0.y));
+
+    Vec3 Dy(-sign * (v2.x - v1.x),
+            -sign * (v0.x - v2.x),
+            -sign * (v1.x - v0.x));
+
+    Vec3 orig(Dx.x * -v1.x + Dy.x * -v1.y,
+              Dx.y * -v2.x + Dy.y * -v2.y,
+              Dx.z * -v0.x + Dy.z * -v0.y);
+
+    // depth is affine in screen space after the perspective divide
+    float zDx = (Dx.x * v0.z + Dx.y * v1.z + Dx.z * v2.z) * invArea;
+    float zDy = (Dy.x * v0.z + Dy.y * v1.z + Dy.z * v2.z) * invArea;
+
+    Vec3 Cy = orig + Dx * ((float)minx + 0.5f) + Dy * ((float)miny + 0.5f);
+    float zy = (Cy.x * v0.z + Cy.y * v1.z + Cy.z * v2.z) * invArea;
+
+    int width = depthBuffer.width();
+
+    for(int y = miny; y < maxy; ++y)
+    {
+        float* depth = depthBuffer.data() + y * width;
+        Vec3 Cx = Cy;
+        float z = zy;
+
+        for(int x = minx; x < maxx; ++x)
+        {
+            if(Cx.x >= 0 && Cx.y >= 0 && Cx.z >= 0 && z < depth[x])
+                depth[x] = z;
+
+            Cx += Dx;
+            z += zDx;
+        }
+
+        Cy += Dy;
+        zy += zDy;
+    }
 }
 
 int RenderingContext::ClipDepth(Vertex (&verts)[9], int count)
@@ -455,8 +1507,8 @@ void RenderingContext::RasterizeHalfSpace(const Rect& rect, const Vertex& v0, co
 
     Vertex yv = v00;
 
-    CullMode cullMode = drawCall->obj->cullMode;
-    Texture* tex = drawCall->obj->texture.get();
+    CullMode cullMode = drawCall->cullMode;
+    Texture* tex = drawCall->texture;
     Vec2 texSize = tex->size();
     float mipBias = tex->mipmapBias();
     int mipCount = tex->mipmapCount();
@@ -626,8 +1678,8 @@ void RenderingContext::RasterizeHalfSpaceMSAA(const Rect& rect, const Vertex& v0
     
     Vertex yv = v00;
 
-    CullMode cullMode = drawCall->obj->cullMode;
-    Texture* tex = drawCall->obj->texture.get();
+    CullMode cullMode = drawCall->cullMode;
+    Texture* tex = drawCall->texture;
     Vec2 texSize = tex->size();
     float mipBias = tex->mipmapBias();
     int mipCount = tex->mipmapCount();
@@ -758,7 +1810,7 @@ void RenderingContext::RasterizeHalfSpaceMSAA(const Rect& rect, const Vertex& v0
 
 void RenderingContext::RasterizeScanline(const Rect& rect, const Vertex& _v0, const Vertex& _v1, const Vertex& _v2, DrawCall* drawCall)
 {
-    auto cullMode = drawCall->obj->cullMode;
+    auto cullMode = drawCall->cullMode;
     if(cullMode != CullMode::None)
     {
         // cross product in screen space -> triangle back-facing?
@@ -825,7 +1877,7 @@ void RenderingContext::FillSpans(const Rect& rect, const Vertex& _l0, const Vert
     l0 += yDeltaLeft * (Math::Ceil(l0.position.y) - l0.position.y);
     r0 += yDeltaRight * (Math::Ceil(r0.position.y) - r0.position.y);
 
-    Texture* tex = drawCall->obj->texture.get();
+    Texture* tex = drawCall->texture;
     Vec2 texSize = tex->size();
     float mipBias = tex->mipmapBias();
     int mipCount = tex->mipmapCount();
@@ -842,11 +1894,11 @@ void RenderingContext::FillSpans(const Rect& rect, const Vertex& _l0, const Vert
 
     for( ; y < y1; ++y)
     {
-        int x = Math::Ceil(l0.position.x);
-        int end = min(Math::Ceil(r0.position.x), (int)_renderWidth);
+        int x = max(Math::Ceil(l0.position.x), rect.x);
+        int end = Math::Min(Math::Ceil(r0.position.x), (int)_renderWidth, rect.x + rect.w);
 
         Vertex xv = l0;
-        xv += xDelta * (Math::Ceil(l0.position.x) - l0.position.x);
+        xv += xDelta * ((float)x - l0.position.x);
 
         uint32_t rowOffset;
         if(_antiAliasingMode == AntiAliasingMode::SSAA_2X)
@@ -908,167 +1960,212 @@ void RenderingContext::Resolve(const Rect& rect)
 
 void RenderingContext::ResolveSSAA2X(const Rect& rect)
 {
+    int destX = rect.x / 2;
     int destY = rect.y / 2;
     int destW = rect.w / 2;
     int destH = rect.h / 2;
 
-    uint32_t* src = _aaBuffer.data() + rect.y * rect.w;
-    uint32_t* dst = _colorBuffer.data() + destY * destW;
-    
-    int count = destW * destH;
-    while(count--)
+    for(int y = destY; y < destY + destH; ++y)
     {
+        uint32_t* src = _aaBuffer.data() + (y * _width + destX) * 4;
+        uint32_t* dst = _colorBuffer.data() + y * _width + destX;
+
+        int count = destW;
+        while(count--)
+        {
 #if USE_SSE
-        __m128i c = _mm_load_si128((__m128i*)src);
-        c = _mm_avg_epu8(c, _mm_srli_si128(c, 4));
-        c = _mm_avg_epu8(c, _mm_srli_si128(c, 8));
-        *dst = _mm_cvtsi128_si32(c);
+            __m128i c = _mm_load_si128((__m128i*)src);
+            c = _mm_avg_epu8(c, _mm_srli_si128(c, 4));
+            c = _mm_avg_epu8(c, _mm_srli_si128(c, 8));
+            *dst = _mm_cvtsi128_si32(c);
 #else
-        uint32_t bgra[4]{0, 0, 0, 0};
+            uint32_t bgra[4]{0, 0, 0, 0};
 
-        for(int i = 0; i < 4; ++i)
-        {
-            ColorBGRA* p = (ColorBGRA*)src + i;
-            bgra[0] += p->b;
-            bgra[1] += p->g;
-            bgra[2] += p->r;
-            bgra[3] += p->a;
-        }
+            for(int i = 0; i < 4; ++i)
+            {
+                ColorBGRA* p = (ColorBGRA*)src + i;
+                bgra[0] += p->b;
+                bgra[1] += p->g;
+                bgra[2] += p->r;
+                bgra[3] += p->a;
+            }
         
-        ColorBGRA* c = (ColorBGRA*)dst;
-        c->b = (uint8_t)(bgra[0] / 4);
-        c->g = (uint8_t)(bgra[1] / 4);
-        c->r = (uint8_t)(bgra[2] / 4);
-        c->a = (uint8_t)(bgra[3] / 4);
+            ColorBGRA* c = (ColorBGRA*)dst;
+            c->b = (uint8_t)(bgra[0] / 4);
+            c->g = (uint8_t)(bgra[1] / 4);
+            c->r = (uint8_t)(bgra[2] / 4);
+            c->a = (uint8_t)(bgra[3] / 4);
 #endif
-        src += 4;
-        dst += 1;
+            src += 4;
+            dst += 1;
+        }
     }
 }
 
 void RenderingContext::ResolveSSAA4X(const Rect& rect)
 {
+    int rx = rect.x / 4;
     int ry = rect.y / 4;
     int rw = rect.w / 4;
     int rh = rect.h / 4;
 
-    auto* src = _aaBuffer.data() + rect.y * rect.w;
-    auto* dst = _colorBuffer.data() + ry * rw;
-    
-    int count = rw * rh;
-    while(count--)
+    for(int y = ry; y < ry + rh; ++y)
     {
+        auto* src = _aaBuffer.data() + (y * _width + rx) * 16;
+        auto* dst = _colorBuffer.data() + y * _width + rx;
+
+        int count = rw;
+        while(count--)
+        {
 #if USE_SSE
-        __m128i c = _mm_load_si128((__m128i*)src);
-        __m128i r = _mm_cvtepu8_epi32(c);
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 4)));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 8)));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 12)));
-        src += 4;
+            __m128i c = _mm_load_si128((__m128i*)src);
+            __m128i r = _mm_cvtepu8_epi32(c);
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 4)));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 8)));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 12)));
+            src += 4;
         
-        c = _mm_load_si128((__m128i*)src);
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(c));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 4)));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 8)));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 12)));
-        src += 4;
-
-        c = _mm_load_si128((__m128i*)src);
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(c));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 4)));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 8)));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 12)));
-        src += 4;
-
-        c = _mm_load_si128((__m128i*)src);
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(c));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 4)));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 8)));
-        r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 12)));
-        src += 4;
-
-        r = _mm_srli_epi32(r, 4);
-        r = _mm_packus_epi32(r, _mm_setzero_si128());
-        r = _mm_packus_epi16(r, _mm_setzero_si128());
-        *dst++ = _mm_cvtsi128_si32(r);
+            c = _mm_load_si128((__m128i*)src);
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(c));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 4)));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 8)));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 12)));
+            src += 4;
+
+            c = _mm_load_si128((__m128i*)src);
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(c));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 4)));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 8)));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 12)));
+            src += 4;
+
+            c = _mm_load_si128((__m128i*)src);
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(c));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 4)));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 8)));
+            r = _mm_add_epi32(r, _mm_cvtepu8_epi32(_mm_srli_si128(c, 12)));
+            src += 4;
+
+            r = _mm_srli_epi32(r, 4);
+            r = _mm_packus_epi32(r, _mm_setzero_si128());
+            r = _mm_packus_epi16(r, _mm_setzero_si128());
+            *dst++ = _mm_cvtsi128_si32(r);
 #else
-        uint32_t bgra[4]{0, 0, 0, 0};
+            uint32_t bgra[4]{0, 0, 0, 0};
 
-        for(int i = 0; i < 16; ++i)
-        {
-            ColorBGRA* p = (ColorBGRA*)src + i;
-            bgra[0] += p->b;
-            bgra[1] += p->g;
-            bgra[2] += p->r;
-            bgra[3] += p->a;
-        }
+            for(int i = 0; i < 16; ++i)
+            {
+                ColorBGRA* p = (ColorBGRA*)src + i;
+                bgra[0] += p->b;
+                bgra[1] += p->g;
+                bgra[2] += p->r;
+                bgra[3] += p->a;
+            }
         
-        ColorBGRA* c = (ColorBGRA*)dst;
-        c->b = (uint8_t)(bgra[0] / 16);
-        c->g = (uint8_t)(bgra[1] / 16);
-        c->r = (uint8_t)(bgra[2] / 16);
-        c->a = (uint8_t)(bgra[3] / 16);
-        src += 16;
-        dst += 1;
+            ColorBGRA* c = (ColorBGRA*)dst;
+            c->b = (uint8_t)(bgra[0] / 16);
+            c->g = (uint8_t)(bgra[1] / 16);
+            c->r = (uint8_t)(bgra[2] / 16);
+            c->a = (uint8_t)(bgra[3] / 16);
+            src += 16;
+            dst += 1;
 #endif
+        }
     }
 }
 
 void RenderingContext::ResolveMSAA4X(const Rect& rect)
 {
-    uint32_t* src = _aaBuffer.data() + rect.y * rect.w * 4;
-    uint32_t* dst = _colorBuffer.data() + rect.y * rect.w;
-
-    int count = rect.w * rect.h;
-    while(count--)
+    for(int y = rect.y; y < rect.y + rect.h; ++y)
     {
+        uint32_t* src = _aaBuffer.data() + (y * _width + rect.x) * 4;
+        uint32_t* dst = _colorBuffer.data() + y * _width + rect.x;
+
+        int count = rect.w;
+        while(count--)
+        {
 #if USE_SSE
-        __m128i c = _mm_load_si128((__m128i*)src);
-        c = _mm_avg_epu8(c, _mm_srli_si128(c, 4));
-        c = _mm_avg_epu8(c, _mm_srli_si128(c, 8));
-        *dst = _mm_cvtsi128_si32(c);
+            __m128i c = _mm_load_si128((__m128i*)src);
+            c = _mm_avg_epu8(c, _mm_srli_si128(c, 4));
+            c = _mm_avg_epu8(c, _mm_srli_si128(c, 8));
+            *dst = _mm_cvtsi128_si32(c);
 #else
-        uint32_t bgra[4]{0, 0, 0, 0};
+            uint32_t bgra[4]{0, 0, 0, 0};
 
-        for(int i = 0; i < 4; ++i)
-        {
-            ColorBGRA* p = (ColorBGRA*)src + i;
-            bgra[0] += p->b;
-            bgra[1] += p->g;
-            bgra[2] += p->r;
-            bgra[3] += p->a;
-        }
+            for(int i = 0; i < 4; ++i)
+            {
+                ColorBGRA* p = (ColorBGRA*)src + i;
+                bgra[0] += p->b;
+                bgra[1] += p->g;
+                bgra[2] += p->r;
+                bgra[3] += p->a;
+            }
         
-        ColorBGRA* c = (ColorBGRA*)dst;
-        c->b = (uint8_t)(bgra[0] / 4);
-        c->g = (uint8_t)(bgra[1] / 4);
-        c->r = (uint8_t)(bgra[2] / 4);
-        c->a = (uint8_t)(bgra[3] / 4);
+            ColorBGRA* c = (ColorBGRA*)dst;
+            c->b = (uint8_t)(bgra[0] / 4);
+            c->g = (uint8_t)(bgra[1] / 4);
+            c->r = (uint8_t)(bgra[2] / 4);
+            c->a = (uint8_t)(bgra[3] / 4);
 #endif
-        src += 4;
-        dst += 1;
+            src += 4;
+            dst += 1;
+        }
     }
 }
 
 void RenderingContext::Clear(bool colorBuffer, bool depthBuffer)
 {
-    if(colorBuffer)
+    // the frame in flight may still be rendering into the buffers
+    _clearColorPending |= colorBuffer;
+    _clearDepthPending |= depthBuffer;
+}
+
+void RenderingContext::ReadPixels(void* pixels, PixelFormat format, size_t stride) const
+{
+    size_t rowSize = _width * sizeof(uint32_t);
+    if(stride == 0)
+        stride = rowSize;
+
+    const uint32_t* src = _presentBuffer.data();
+    uint8_t* dst = (uint8_t*)pixels;
+
+    for(uint32_t y = 0; y < _height; ++y)
     {
-        if(_antiAliasingMode == AntiAliasingMode::Off
-        || (_antiAliasingMode == AntiAliasingMode::MSAA_4X && _rasterizationMode == RasterizationMode::Scanline))
-            _colorBuffer.Fill(_clearColor);
+        if(format == PixelFormat::BGRA8)
+        {
+            memcpy(dst, src, rowSize);
+        }
         else
-            _aaBuffer.Fill(_clearColor);
-    }
+        {
+            uint32_t* out = (uint32_t*)dst;
 
-    if(depthBuffer)
-        _depthBuffer.Fill(0);
+            // swap the red and blue bytes
+            for(uint32_t x = 0; x < _width; ++x)
+            {
+                uint32_t c = src[x];
+                out[x] = (c & 0xFF00FF00) | ((c >> 16) & 0xFF) | ((c & 0xFF) << 16);
+            }
+        }
+
+        src += _width;
+        dst += stride;
+    }
 }
 
 void RenderingContext::Present()
 {
+    if(_target)
+    {
+        ReadPixels(_target, PixelFormat::BGRA8, _targetStride * sizeof(uint32_t));
+        return;
+    }
+
+#ifdef _WIN32
+    if(!_hWndTarget)
+        return;
+
     RECT tmp;
-    GetClientRect(_hWndTarget, &tmp);
+    GetClientRect((HWND)_hWndTarget, &tmp);
     Rect window(tmp.left, tmp.top, tmp.right - tmp.left, tmp.bottom - tmp.top);
 
     Rect rc(0, 0, _width, _height);
@@ -1091,6 +2188,7 @@ void RenderingContext::Present()
     bmi.bmiHeader.biClrUsed = 0;
     bmi.bmiHeader.biClrImportant = 0;
 
-    StretchDIBits(_hDCTarget, rc.x, rc.y, rc.w, rc.h, 0, 0, _width, _height, _colorBuffer.data(), (BITMAPINFO*)&bmi, DIB_RGB_COLORS, SRCCOPY);
-    //SetDIBitsToDevice(hDC, 0, 0, _width, _height, 0, 0, 0, _height, _colorBuffer.data(), (BITMAPINFO*)&bmi, DIB_RGB_COLORS);
+    StretchDIBits((HDC)_hDCTarget, rc.x, rc.y, rc.w, rc.h, 0, 0, _width, _height, _presentBuffer.data(), (BITMAPINFO*)&bmi, DIB_RGB_COLORS, SRCCOPY);
+    //SetDIBitsToDevice(hDC, 0, 0, _width, _height, 0, 0, 0, _height, _presentBuffer.data(), (BITMAPINFO*)&bmi, DIB_RGB_COLORS);
+#endif
 }
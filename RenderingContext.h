@@ -4,27 +4,40 @@
 *--------------------------------------------------------------------------------------------*/
 
 #pragma once
-#include <Windows.h>
-#include <process.h>
 #include <cstdlib>
 #include <cstdint>
+#include <atomic>
 #include <memory>
+#include <unordered_map>
 #include <vector>
+#include "Arena.h"
+#include "DirtyTiles.h"
 #include "Math.h"
 #include "Mem.h"
 #include "Vertex.h"
 #include "RenderBuffer.h"
+#include "SceneObject.h"
 #include "Shader.h"
 
 using namespace std;
 
 class Application;
-class RenderThread;
+class Job;
+class JobGroup;
+class JobSystem;
+class LightClusters;
 class Texture;
 class Shader;
 class Scene;
 class SceneObject;
+class InstancedObject;
+struct InstanceData;
 class Light;
+class ShadowMap;
+struct DrawState;
+struct VertexCache;
+struct PackedVertex;
+struct VertexQuantization;
 
 enum class RasterizationMode
 {
@@ -40,20 +53,106 @@ enum class AntiAliasingMode
     SSAA_4X,
 };
 
+// byte order of the pixels read back from a context
+enum class PixelFormat
+{
+    BGRA8,
+    RGBA8,
+};
+
+// vertices [first, last) of a draw call, processed by one geometry job
+struct VertexRange
+{
+    size_t first;
+    size_t last;
+};
+
 struct DrawCall
 {
-    size_t start;
-    size_t end;
-    SceneObject* obj;
+    size_t firstBatch;
+    size_t lastBatch;
+    SceneObject* obj;             // null for an instance
+    InstancedObject* instanced;   // null for a scene object
+    const InstanceData* instance; // in the frame's arena
+    const Vertex* vertices;       // of the model LOD it's drawn with
+    const PackedVertex* packedVertices; // instead of 'vertices' if the model is packed
+    const VertexQuantization* quantization;
+    size_t vertexCount;
+    const VertexRange* ranges;    // one per batch, leaving out the meshlets that can't be seen
+    Texture* texture; // taken when the frame is built, since the object's texture may change before it's rasterized
     Shader *shader;
+    CullMode cullMode;
+    VertexCache* cache; // null if the object's geometry isn't cached
+    bool fillCache;     // copy the processed batches into 'cache'
+    Rect bounds;        // of its triangles, once they're processed
+};
+
+// a range of an object's triangles, transformed and clipped by one job
+struct GeometryBatch
+{
+    size_t drawCall;
+    size_t first;
+    size_t last;
+    Vertex* verts; // screen space triangles, in the arena of the job that processed them
+    size_t vertCount;
+    Rect bounds;   // of the triangles, in render target pixels
+};
+
+// an object's screen space triangles from an earlier frame, which are drawn again
+// for as long as the object's draw state, its model, its LOD and the render size don't change
+struct VertexCache
+{
+    weak_ptr<SceneObject> owner; // the object may be gone, and another one allocated in its place
+    uint32_t stateVersion = 0;
+    const Model* model = nullptr; // replaced once it's loaded, for one
+    uint32_t modelVersion = 0;
+    int lod = 0;
+    uint32_t renderWidth = 0;
+    uint32_t renderHeight = 0;
+    uint64_t lastDrawn = 0;       // frame number
+    bool filled = false;
+    vector<Vertex, AlignedAllocator<Vertex, 16>> verts;
+    Rect bounds;
 };
 
 class RenderingContext
 {    
 public:
-    friend class RenderThread;
+    // model vertices per geometry job
+    static constexpr size_t BatchSize = 3 * 512;
+
+    // packed vertices are unpacked this many at a time, on the stack, as they're processed
+    static constexpr size_t UnpackSize = 3 * 16;
+
+    // screen strips per thread, more than one so that threads finishing early can steal the rest
+    static constexpr size_t StripsPerThread = 4;
+
+    // rows per band of measured raster cost. strips are cut at band
+    // boundaries, which also keeps them aligned to the SSAA resolve.
+    static constexpr int CostBandHeight = 4;
 
+    // weight of the latest frame's timings in the band costs
+    static constexpr float CostSmoothing = 0.5f;
+
+    // a frame can be prepared while the previous one is still being rasterized
+    static constexpr uint32_t MaxFramesInFlight = 2;
+
+    // default memory for cached geometry, in bytes
+    static constexpr size_t DefaultVertexCacheSize = 64 * 1024 * 1024;
+
+#ifdef _WIN32
+    // renders with a job system of its own
     RenderingContext(Application* app, uint32_t width, uint32_t height, size_t threadCount);
+
+    // renders with a job system shared with other contexts, such as JobSystem::shared()
+    RenderingContext(Application* app, uint32_t width, uint32_t height, const shared_ptr<JobSystem>& jobSystem);
+#endif
+
+    // renders offscreen, without a window. the finished frames are read
+    // back with ReadPixels(), or copied into a target set with target().
+    // presenting to a window is only supported on Windows, so this is the
+    // only constructor on other platforms.
+    RenderingContext(uint32_t width, uint32_t height, const shared_ptr<JobSystem>& jobSystem);
     ~RenderingContext();
 
     void clearColor(const Color &color);
@@ -67,16 +166,114 @@ public:
 
     void mipmapsEnabled(bool enabled);
     bool mipmapsEnabled() const;
+
+    // with more than one frame in flight, Draw() returns once the frame's geometry is processed
+    // and the frame is rasterized in the background while the next one is prepared. Present()
+    // then shows the last finished frame, which is one frame behind the last call to Draw().
+    // scene objects, lights and textures used by a frame must be kept alive until it's finished.
+    void maxFramesInFlight(uint32_t count);
+    uint32_t maxFramesInFlight() const;
+
+    // memory in bytes for keeping the geometry of objects that haven't moved relative to the
+    // camera, so it isn't processed again. geometry is only cached once an object's draw
+    // state has been the same for two frames in a row. 0 turns caching off.
+    void vertexCacheSize(size_t bytes);
+    size_t vertexCacheSize() const;
+    size_t vertexCacheUsed() const;
+
+    // only render the tiles of the screen that something changed in since the last frame,
+    // and keep the rest. needs the color and depth buffers cleared every frame. objects
+    // are compared by their transform, model, shader, texture and lightmap, so changes to
+    // the contents of a texture aren't picked up while this is enabled. off by default,
+    // callers that only ever replace textures, instead of writing to them, can turn it on.
+    void incrementalRendering(bool enabled);
+    bool incrementalRendering() const;
+
+    // share of a shared job system's workers this context gets while other contexts are also busy
+    void priority(int priority);
+    int priority() const;
     
     uint32_t width() const;
     uint32_t height() const;
-    HWND targetWindow() const;
+    void* targetWindow() const; // HWND, null for an offscreen context
+    JobSystem& jobSystem();
+
+    // the number of the last frame drawn, counting from 1, and of the last one that has finished.
+    // what a frame used can be freed once finishedFrameNumber() has caught up with its number.
+    uint64_t frameNumber() const;
+    uint64_t finishedFrameNumber() const;
 
+    // caller owned BGRA pixels that Present() copies the last finished frame into,
+    // instead of the window. 'stride' is in pixels, 0 for rows packed back to back.
+    void target(uint32_t* pixels, uint32_t stride = 0);
+    uint32_t* target() const;
+
+    // the buffers are cleared when the next frame drawn starts rasterizing.
+    // a frame drawn without clearing the color buffer draws over the last frame.
     void Clear(bool colorBuffer = true, bool depthBuffer = true);
+
+    // a scene can only be drawn by one context. the draw states of its objects, their LODs, the
+    // shadow maps of its lights, and its bvh and light clusters are written for the frames of the
+    // context drawing it, and another context would overwrite them while those are rasterized.
+    // the scene is the context's until it draws another one, or is destroyed. drawing a scene
+    // another context has throws, two views of a scene need a scene each.
     void Draw(const shared_ptr<Scene>& scene);
     void Present();
 
+    // waits for the frame in flight to finish
+    void Flush();
+
+    // copies the last finished frame into 'pixels', 'stride' bytes apart per row or 0 for packed rows.
+    // with frames in flight, call Flush() first to read the frame last drawn.
+    void ReadPixels(void* pixels, PixelFormat format = PixelFormat::BGRA8, size_t stride = 0) const;
+
 private:
+    // everything a frame needs until it has been rasterized. the draw calls, shader
+    // copies and transformed geometry are allocated from the frame's arenas, which
+    // are reset once the frame is finished.
+    struct Frame
+    {
+        uint64_t number = 0;
+        shared_ptr<Scene> scene;
+        shared_ptr<LightClusters> lightClusters;
+        Arena arena;
+        vector<unique_ptr<Arena>> geometryArenas; // one per geometry job
+        DrawCall* drawCalls = nullptr;
+        size_t drawCallCount = 0;
+        GeometryBatch* batches = nullptr;
+        size_t batchCount = 0;
+        size_t pendingBatchCount = 0; // batches at the front that aren't cached
+        atomic<size_t> nextBatch; // next one for a geometry job to take
+        unordered_map<const SceneObject*, VertexCache> vertexCaches;
+        vector<Rect> strips; // the dirty parts of the screen if incremental
+        vector<float> stripTimes;
+        bool incremental = false;
+        bool clearColor = false;
+        bool clearDepth = false;
+        shared_ptr<Job> rasterJob;
+    };
+
+    Shader* PrepareShader(Scene& scene, SceneObject& obj, DrawState& state);
+    Shader* PrepareShader(Scene& scene, InstancedObject& obj, DrawState& state);
+    VertexCache* FindVertexCache(Frame& frame, const shared_ptr<SceneObject>& obj, const DrawState& state, bool& fill);
+    void FillVertexCache(Frame& frame, const DrawCall& drawCall);
+    void ReleaseVertexCache(VertexCache& cache);
+    void ClearVertexCaches();
+    size_t CullMeshlets(Frame& frame, DrawCall& drawCall, const Model& model, int lod, const Mat4& mtxModel, const Camera& camera);
+    void DrawShadowMaps(const shared_ptr<Scene>& scene);
+    void DrawShadowMap(ShadowMap& shadowMap);
+    void AddShadowCaster(const Model& model, const Mat4& mtxMVP, float size);
+    void AddShadowTriangles(const Vertex* vertices, size_t count, const Mat4& mtxMVP, float size);
+    void SplitRows(int width, int height, vector<Rect>& strips) const;
+    void SplitByCost(int width, int height, vector<Rect>& strips);
+    void UpdateCosts(const Frame& frame);
+    void ProcessGeometry(const Frame& frame, GeometryBatch& batch, Arena& arena);
+    void RasterizeFrame(Frame& frame);
+    void RasterizeStrip(Frame& frame, const Rect& rect);
+    void ClearRect(const Rect& rect);
+    void EndFrame(Frame& frame);
+    void RasterizeShadowMap(ShadowMap& shadowMap, const Rect& rect);
+    void RasterizeDepth(RenderBuffer<float>& depthBuffer, const Rect& rect, const Vec4& v0, const Vec4& v1, const Vec4& v2);
     int ClipDepth(Vertex (&verts)[9], int count);
     int ClipScreen(Vertex (&verts)[9], int count);
     static float CalcMipLevel(const Vec2& uv00, const Vec2& uv01, const Vec2& uv10, const Vec2& texSize, float mipBias, int mipCount);
@@ -99,13 +296,32 @@ private:
     bool _mipmapsEnabled;
     Color _clearColor;
     RenderBuffer<uint32_t> _colorBuffer;
+    RenderBuffer<uint32_t> _presentBuffer; // last finished frame
     RenderBuffer<uint32_t> _aaBuffer;
     RenderBuffer<float> _depthBuffer;
-    vector<Vertex, AlignedAllocator<Vertex, 16>> _xverts;
-    vector<Vertex, AlignedAllocator<Vertex, 16>> _cverts;
-    vector<DrawCall, AlignedAllocator<DrawCall, 16>> _drawCalls;
-    vector<unique_ptr<RenderThread>> _renderThreads;
-    ShaderList _shaders;
-    HWND _hWndTarget;
-    HDC _hDCTarget;
+    Frame _frames[MaxFramesInFlight];
+    uint32_t _frameIndex;
+    uint32_t _maxFramesInFlight;
+    Frame* _rasterizingFrame;
+    uint64_t _frameNumber;
+    uint64_t _finishedFrameNumber;
+    shared_ptr<Scene> _scene; // the last one drawn, see Draw()
+    size_t _vertexCacheSize;
+    size_t _vertexCacheUsed;
+    vector<float> _bandCosts; // smoothed raster time of each band of rows, in seconds
+    DirtyTiles _dirtyTiles;
+    bool _incrementalRendering;
+    bool _clearColorPending;
+    bool _clearDepthPending;
+    vector<Vec4, AlignedAllocator<Vec4, 16>> _shadowVerts;
+    vector<Rect> _shadowStrips;
+    vector<uint32_t> _visibleObjects;
+    vector<uint32_t> _visibleInstances;
+    vector<size_t> _visibleInstanceEnds; // of each instanced object's range of _visibleInstances
+    shared_ptr<JobSystem> _jobSystem;
+    JobGroup* _jobGroup;
+    void* _hWndTarget;
+    void* _hDCTarget;
+    uint32_t* _target;
+    uint32_t _targetStride;
 };
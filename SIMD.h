@@ -6,6 +6,7 @@
 #pragma once
 #include <xmmintrin.h>
 #include <emmintrin.h>
+#include <smmintrin.h>
 #include <cassert>
 #include "Mem.h"
 
@@ -8,6 +8,12 @@
 #include <exception>
 #include <string>
 
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <iostream>
+#endif
+
 void Scene::ApplySettings(const string& filename)
 {
     try {
@@ -98,9 +104,38 @@ void Scene::ApplySettings(const string& filename)
                 }
             }
         }
+
+        // the instances of an instanced object are placed by the entries
+        // named after it, numbered from 1 ("plants1", "plants2", ...)
+        for(auto& io : instancedObjects)
+        {
+            for(uint32_t i = 0; ; ++i)
+            {
+                auto it = settings.find(io->name + to_string(i + 1));
+                if(it == settings.end())
+                    break;
+
+                JSONValue& data = it->second;
+
+                auto& pos = data["pos"];
+                auto& rot = data["rot"];
+
+                Vec3 position(pos[0], pos[1], pos[2]);
+                Quat rotation(Vec3(rot[0], rot[1], rot[2]));
+
+                if(i < io->instanceCount())
+                    io->SetInstance(i, position, rotation, io->GetScale(i));
+                else
+                    io->AddInstance(position, rotation, Vec3(1.0f, 1.0f, 1.0f));
+            }
+        }
     }
     catch(std::exception& ex) {
+#ifdef _WIN32
         MessageBox(0, ex.what(), "Error loading scene settings", MB_OK | MB_ICONERROR);
+#else
+        cerr << "Error loading scene settings: " << ex.what() << endl;
+#endif
     }
 }
 
@@ -112,6 +147,14 @@ shared_ptr<SceneObject> Scene::FindObject(const string& name)
     return it != objects.end() ? *it : shared_ptr<SceneObject>();
 }
 
+shared_ptr<InstancedObject> Scene::FindInstancedObject(const string& name)
+{
+    auto it = find_if(instancedObjects.begin(), instancedObjects.end(), [&name](auto& io){
+        return io->name == name;
+    });
+    return it != instancedObjects.end() ? *it : shared_ptr<InstancedObject>();
+}
+
 shared_ptr<Light> Scene::FindLight(const string& name)
 {
     auto it = find_if(lights.begin(), lights.end(), [&name](auto& light){
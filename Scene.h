@@ -4,22 +4,41 @@
 *--------------------------------------------------------------------------------------------*/
 
 #pragma once
+#include "BoundingVolumeHierarchy.h"
 #include "Camera.h"
+#include "InstancedObject.h"
 #include "Shader.h"
 #include "Model.h"
 #include "SceneObject.h"
 #include "Light.h"
+#include "LightClusters.h"
 #include <vector>
 #include <memory>
 
+class RenderingContext;
+
 class Scene
 {
 public:
     vector<shared_ptr<SceneObject>> objects;
+    vector<shared_ptr<InstancedObject>> instancedObjects;
     vector<shared_ptr<Light>> lights;
     shared_ptr<Camera> camera;
 
+    // bounds of 'objects' for culling, brought up to date by the rendering context every frame
+    BoundingVolumeHierarchy bvh;
+
+    // lights binned for the frame being drawn, set by the rendering context
+    shared_ptr<LightClusters> lightClusters;
+
+    // the rendering context the scene is drawn by. a scene can only be drawn by one context,
+    // since the objects, lights and the scene itself keep what was drawn with them, see RenderingContext::Draw()
+    const RenderingContext* context = nullptr;
+
+    // places the objects and lights by name. the instances of an instanced object are
+    // the entries named after it with a number, starting from 1, and are added as needed.
     void ApplySettings(const string& filename);
     shared_ptr<SceneObject> FindObject(const string& name);
+    shared_ptr<InstancedObject> FindInstancedObject(const string& name);
     shared_ptr<Light> FindLight(const string& name);
 };
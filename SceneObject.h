@@ -11,6 +11,10 @@
 #include "Transform.h"
 using namespace std;
 
+class Camera;
+class LightClusters;
+class Scene;
+
 enum class CullMode
 {
     None,
@@ -18,6 +22,22 @@ enum class CullMode
     Front
 };
 
+// an object's own copy of its shader as last prepared for drawing, and what it was prepared from
+struct DrawState
+{
+    shared_ptr<Shader> shader;
+    const Shader* source = nullptr;
+    uint32_t sourceVersion = 0;
+    const Scene* scene = nullptr;
+    const Camera* camera = nullptr;
+    uint32_t cameraVersion = 0;
+    uint32_t transformVersion = 0;
+    const Texture* texture = nullptr;
+    const Texture* lightmap = nullptr;
+    const LightClusters* lightClusters = nullptr;
+    uint32_t version = 0; // incremented whenever the copy is prepared again
+};
+
 class alignas(16) SceneObject
 {
 public:
@@ -27,6 +47,22 @@ public:
     shared_ptr<Texture> texture;
     shared_ptr<Shader> shader;
     CullMode cullMode;
+    bool castShadows = true;
+
+    // lighting from static lights can be baked into the lightmap of static objects
+    bool isStatic = false;
+    shared_ptr<Texture> lightmap;
+
+    // lighting LOD picked by LitShader on the last frame the object was drawn
+    bool vertexLit = false;
+
+    // model LOD picked on the last frame the object was drawn, see Model::SelectLOD
+    int lod = 0;
+
+    // one per frame a rendering context can have in flight, so that preparing
+    // the next frame doesn't change what the previous one is rasterized with
+    static constexpr int DrawStateCount = 2;
+    DrawState drawStates[DrawStateCount];
 
     SceneObject(const string& name,
                 const shared_ptr<Model>& model,
@@ -5,21 +5,54 @@
 
 #pragma once
 #include <cassert>
-#include "poly_vector.h"
+#include <cstdint>
+#include <memory>
+#include "Vertex.h"
 
 class Shader;
 class Scene;
 class SceneObject;
-class Vertex;
-
-typedef poly_vector<Shader, AlignedAllocator<uint8_t, 16>> ShaderList;
+class InstancedObject;
+struct InstanceData;
 
 class alignas(16) Shader
 {
+    uint32_t _version = 0;
+
 public:
     virtual ~Shader(){}
-    virtual void CopyTo(ShaderList& copies) = 0;
+
+    // objects are drawn with copies of their shader that are kept from frame to frame,
+    // and only prepared again when something they depend on has changed
+    virtual std::shared_ptr<Shader> Clone() const = 0;
     virtual void Prepare(Scene* scene, SceneObject* obj) = 0;
     virtual Vertex ProcessVertex(const Vertex &in) = 0;
     virtual Color ProcessPixel(const Vertex &in, float mipLevel, bool& discard) = 0;
+
+    // instanced objects are drawn with a single copy of their shader for all of their instances.
+    // shaders that can draw them return true from PrepareInstanced, and transform the vertices
+    // of each instance with the matrices given to the second ProcessVertex.
+    virtual bool PrepareInstanced(Scene* scene, InstancedObject* obj) {
+        return false;
+    }
+
+    virtual Vertex ProcessVertex(const Vertex &in, const InstanceData &instance) {
+        return ProcessVertex(in);
+    }
+
+    // false if ProcessVertex depends on more than what the shader was prepared with (like lights
+    // that can move between frames), in which case its output can't be kept from frame to frame,
+    // and the copy is prepared again every frame
+    virtual bool cacheableVertices() const {
+        return true;
+    }
+
+    // to be called after changing a shader's settings, so that the copies pick them up
+    void SettingsChanged() {
+        ++_version;
+    }
+
+    uint32_t version() const {
+        return _version;
+    }
 };
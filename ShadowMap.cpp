@@ -0,0 +1,404 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "ShadowMap.h"
+#include "Camera.h"
+#include "InstancedObject.h"
+#include "Scene.h"
+#include "SceneObject.h"
+#include "SIMD.h"
+#include <cmath>
+
+////////////////////////////////
+//    ShadowMap
+////////////////////////////////
+
+ShadowMap::ShadowMap()
+{
+    _current = 0;
+    _size = 0;
+    _mtxVP = Mat4::identity;
+    _lightPos = Vec4(0, 0, 0, 1);
+    _extent = 0;
+    _valid = false;
+    _renderedVP = Mat4::identity;
+
+    for(auto& buffer : _buffers)
+    {
+        buffer._owner = this;
+        buffer._mtxVP = Mat4::identity;
+        buffer._lightPos = _lightPos;
+    }
+}
+
+void ShadowMap::Resize(uint32_t size)
+{
+    if(size == _size)
+        return;
+
+    // buffers are resized as they get rendered into, since the
+    // previous frame may still be sampling the current one
+    _size = size;
+    Invalidate();
+}
+
+uint32_t ShadowMap::size() const {
+    return _size;
+}
+
+void ShadowMap::SetViewProjection(const Mat4& mtxVP, const Vec4& lightPos, float extent)
+{
+    _mtxVP = mtxVP;
+    _lightPos = lightPos;
+    _extent = extent;
+
+    _frustum[0].a = _mtxVP.m14 + _mtxVP.m11;
+    _frustum[0].b = _mtxVP.m24 + _mtxVP.m21;
+    _frustum[0].c = _mtxVP.m34 + _mtxVP.m31;
+    _frustum[0].d = _mtxVP.m44 + _mtxVP.m41;
+
+    _frustum[1].a = _mtxVP.m14 - _mtxVP.m11;
+    _frustum[1].b = _mtxVP.m24 - _mtxVP.m21;
+    _frustum[1].c = _mtxVP.m34 - _mtxVP.m31;
+    _frustum[1].d = _mtxVP.m44 - _mtxVP.m41;
+
+    _frustum[2].a = _mtxVP.m14 - _mtxVP.m12;
+    _frustum[2].b = _mtxVP.m24 - _mtxVP.m22;
+    _frustum[2].c = _mtxVP.m34 - _mtxVP.m32;
+    _frustum[2].d = _mtxVP.m44 - _mtxVP.m42;
+
+    _frustum[3].a = _mtxVP.m14 + _mtxVP.m12;
+    _frustum[3].b = _mtxVP.m24 + _mtxVP.m22;
+    _frustum[3].c = _mtxVP.m34 + _mtxVP.m32;
+    _frustum[3].d = _mtxVP.m44 + _mtxVP.m42;
+
+    _frustum[4].a = _mtxVP.m13;
+    _frustum[4].b = _mtxVP.m23;
+    _frustum[4].c = _mtxVP.m33;
+    _frustum[4].d = _mtxVP.m43;
+
+    _frustum[5].a = _mtxVP.m14 - _mtxVP.m13;
+    _frustum[5].b = _mtxVP.m24 - _mtxVP.m23;
+    _frustum[5].c = _mtxVP.m34 - _mtxVP.m33;
+    _frustum[5].d = _mtxVP.m44 - _mtxVP.m43;
+
+    for(int p = 0; p < 6; ++p)
+        _frustum[p].Normalize();
+}
+
+const Mat4& ShadowMap::GetVPMatrix() const {
+    return _mtxVP;
+}
+
+bool ShadowMap::CanSee(const Sphere& bounds) const
+{
+    for(int p = 0; p < 6; ++p)
+    {
+        if(_frustum[p].InBack(bounds))
+            return false;
+    }
+
+    return true;
+}
+
+bool ShadowMap::UpdateCasters(const Scene& scene)
+{
+    _casters.clear();
+    _casterVersions.clear();
+
+    _inFrustum.clear();
+    scene.bvh.Cull(_frustum, 6, _inFrustum);
+
+    for(uint32_t index : _inFrustum)
+    {
+        SceneObject* obj = scene.objects[index].get();
+        if(!obj->castShadows || obj->model->GetVertexCount(0) == 0)
+            continue;
+
+        _casters.push_back(obj);
+        _casterVersions.push_back(CasterVersion{ obj->model.get(), obj->model->GetVersion(), obj->transform.GetVersion() });
+    }
+
+    _instancedCasters.clear();
+    _casterInstances.clear();
+
+    for(auto& obj : scene.instancedObjects)
+    {
+        if(!obj->castShadows || obj->model->GetVertexCount(0) == 0)
+            continue;
+
+        size_t first = _casterInstances.size();
+        obj->Cull(_frustum, 6, _casterInstances);
+
+        if(_casterInstances.size() > first)
+            _instancedCasters.push_back(InstancedCaster{ obj.get(), obj->GetVersion(), first, _casterInstances.size() });
+    }
+
+    bool changed = !_valid
+        || !(_renderedVP == _mtxVP)
+        || _renderedCasters != _casters
+        || _renderedVersions != _casterVersions
+        || InstancedCastersChanged();
+
+    if(changed)
+    {
+        _valid = true;
+        _renderedVP = _mtxVP;
+        _renderedCasters = _casters;
+        _renderedVersions = _casterVersions;
+        _renderedInstancedCasters = _instancedCasters;
+
+        _current = (_current + 1) % BufferCount;
+
+        Buffer& buffer = _buffers[_current];
+        buffer._depthBuffer.Resize(_size, _size, 1);
+        buffer._size = _size;
+        buffer._mtxVP = _mtxVP;
+        buffer._lightPos = _lightPos;
+        buffer._extent = _extent;
+        buffer._valid = true;
+    }
+
+    return changed;
+}
+
+const vector<SceneObject*>& ShadowMap::GetCasters() const {
+    return _casters;
+}
+
+const vector<ShadowMap::InstancedCaster>& ShadowMap::GetInstancedCasters() const {
+    return _instancedCasters;
+}
+
+const vector<uint32_t>& ShadowMap::GetCasterInstances() const {
+    return _casterInstances;
+}
+
+bool ShadowMap::InstancedCastersChanged() const
+{
+    if(_instancedCasters.size() != _renderedInstancedCasters.size())
+        return true;
+
+    // with the same instances and projection, the same ones are inside the frustum
+    for(size_t i = 0; i < _instancedCasters.size(); ++i)
+    {
+        if(_instancedCasters[i].obj != _renderedInstancedCasters[i].obj
+        || _instancedCasters[i].version != _renderedInstancedCasters[i].version)
+            return true;
+    }
+
+    return false;
+}
+
+void ShadowMap::Invalidate() {
+    _valid = false;
+}
+
+RenderBuffer<float>& ShadowMap::depthBuffer() {
+    return _buffers[_current]._depthBuffer;
+}
+
+const ShadowMap::Buffer& ShadowMap::buffer() const {
+    return _buffers[_current];
+}
+
+bool ShadowMap::Sample(const Vec3& worldPos, const Vec3& normal, float& light) const {
+    return buffer().Sample(worldPos, normal, light);
+}
+
+float ShadowMap::Sample(const Vec3& worldPos, const Vec3& normal) const {
+    return buffer().Sample(worldPos, normal);
+}
+
+////////////////////////////////
+//    ShadowMap::Buffer
+////////////////////////////////
+
+bool ShadowMap::Buffer::Sample(const Vec3& worldPos, const Vec3& normal, float& light) const
+{
+    if(!_valid || _size < 4)
+        return false;
+
+    Vec4 clip = Vec4(worldPos, 1.0f) * _mtxVP;
+    if(clip.w <= 0)
+        return false;
+
+    // push the lookup off the surface to avoid self shadowing
+    float texelSize = clip.w * _extent / (float)_size;
+    Vec3 toLight = Vec3(_lightPos) - worldPos * _lightPos.w;
+    toLight.Normalize();
+
+    Vec3 pos = worldPos + normal * (_owner->normalBias * texelSize) + toLight * (_owner->depthBias * texelSize);
+
+    clip = Vec4(pos, 1.0f) * _mtxVP;
+    if(clip.w <= 0)
+        return false;
+
+    float rw = 1.0f / clip.w;
+    float x = (clip.x * rw + 1.0f) * 0.5f * (float)_size;
+    float y = (1.0f - clip.y * rw) * 0.5f * (float)_size;
+    float z = clip.z * rw;
+
+    if(x < 0 || y < 0 || x > (float)_size || y > (float)_size)
+        return false;
+
+    light = z < 1.0f ? Filter(x, y, z) : 1.0f;
+    return true;
+}
+
+float ShadowMap::Buffer::Sample(const Vec3& worldPos, const Vec3& normal) const
+{
+    float light;
+    return Sample(worldPos, normal, light) ? light : 1.0f;
+}
+
+float ShadowMap::Buffer::Filter(float x, float y, float depth) const
+{
+    // nine bilinear taps one texel apart, which reduces to a 4x4 block
+    // of depth tests weighted by (1-f, 1, 1, f) along each axis
+    float sx = x - 0.5f;
+    float sy = y - 0.5f;
+    int ix = Math::Floor(sx);
+    int iy = Math::Floor(sy);
+    float fx = sx - (float)ix;
+    float fy = sy - (float)iy;
+
+    int maxStart = (int)_size - 4;
+    int x0 = Math::Clamp(ix - 1, 0, maxStart);
+    int y0 = Math::Clamp(iy - 1, 0, maxStart);
+
+    const float* row = _depthBuffer.data() + y0 * _size + x0;
+
+#if USE_SSE
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128 ref = _mm_set1_ps(depth);
+    __m128 wx = _mm_set_ps(fx, 1.0f, 1.0f, 1.0f - fx);
+    __m128 wy = _mm_set_ps(fy, 1.0f, 1.0f, 1.0f - fy);
+
+    __m128 r0 = _mm_and_ps(_mm_cmple_ps(ref, _mm_loadu_ps(row)), one);
+    __m128 r1 = _mm_and_ps(_mm_cmple_ps(ref, _mm_loadu_ps(row + _size)), one);
+    __m128 r2 = _mm_and_ps(_mm_cmple_ps(ref, _mm_loadu_ps(row + _size * 2)), one);
+    __m128 r3 = _mm_and_ps(_mm_cmple_ps(ref, _mm_loadu_ps(row + _size * 3)), one);
+
+    __m128 sum = _mm_mul_ps(r0, _mm_shuffle_ps(wy, wy, _MM_SHUFFLE(0, 0, 0, 0)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(r1, _mm_shuffle_ps(wy, wy, _MM_SHUFFLE(1, 1, 1, 1))));
+    sum = _mm_add_ps(sum, _mm_mul_ps(r2, _mm_shuffle_ps(wy, wy, _MM_SHUFFLE(2, 2, 2, 2))));
+    sum = _mm_add_ps(sum, _mm_mul_ps(r3, _mm_shuffle_ps(wy, wy, _MM_SHUFFLE(3, 3, 3, 3))));
+    sum = _mm_mul_ps(sum, wx);
+
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(sum) * (1.0f / 9.0f);
+#else
+    float wx[4]{ 1.0f - fx, 1.0f, 1.0f, fx };
+    float wy[4]{ 1.0f - fy, 1.0f, 1.0f, fy };
+    float sum = 0;
+
+    for(int j = 0; j < 4; ++j, row += _size)
+    {
+        for(int i = 0; i < 4; ++i)
+        {
+            if(depth <= row[i])
+                sum += wx[i] * wy[j];
+        }
+    }
+
+    return sum * (1.0f / 9.0f);
+#endif
+}
+
+////////////////////////////////
+//    CascadedShadowMap
+////////////////////////////////
+
+CascadedShadowMap::CascadedShadowMap()
+{
+    Resize(512);
+}
+
+void CascadedShadowMap::Resize(uint32_t size)
+{
+    for(auto& cascade : cascades)
+        cascade.Resize(size);
+}
+
+void CascadedShadowMap::Update(const Camera& camera, const Vec3& lightDir)
+{
+    float nearPlane = camera.GetNearPlane();
+    float farPlane = Math::Min(shadowDistance, camera.GetFarPlane());
+
+    float tanX = tan(Math::DegToRad * camera.GetFieldOfView() * 0.5f);
+    float tanY = tanX / camera.GetAspectRatio();
+    float kSq = tanX * tanX + tanY * tanY;
+
+    const Mat4& mtxCamera = camera.transform.GetMatrix();
+
+    Vec3 up = abs(lightDir.y) > 0.99f ? Vec3::forward : Vec3::up;
+    Mat4 mtxLight = Mat4::InverseTransform(Vec3::zero, Vec3(1, 1, 1), Quat::LookRotation(lightDir, up));
+
+    float splitNear = nearPlane;
+
+    for(int i = 0; i < CascadeCount; ++i)
+    {
+        float t = (float)(i + 1) / (float)CascadeCount;
+        float uniformSplit = nearPlane + (farPlane - nearPlane) * t;
+        float logSplit = nearPlane * pow(farPlane / nearPlane, t);
+        float splitFar = Math::Lerp(uniformSplit, logSplit, splitBlend);
+
+        // bounding sphere of the frustum slice. It only depends on the slice's
+        // depth range, so it stays the same size as the camera rotates.
+        float n = splitNear;
+        float f = splitFar;
+        float c = Math::Min((f + n) * 0.5f * (1.0f + kSq), f);
+        float radius = sqrt(Math::Max(n * n * kSq + (n - c) * (n - c), f * f * kSq + (f - c) * (f - c)));
+        radius = Math::Ceil(radius * 16.0f) / 16.0f;
+
+        Vec3 center = Vec4(0, 0, c, 1.0f) * mtxCamera;
+
+        // snap to whole texels so the shadows don't shimmer as the camera moves
+        ShadowMap& cascade = cascades[i];
+        float extent = radius * 2.0f;
+        float texelSize = extent / (float)cascade.size();
+
+        Vec3 lsCenter = Vec4(center, 1.0f) * mtxLight;
+        lsCenter.x = floor(lsCenter.x / texelSize) * texelSize;
+        lsCenter.y = floor(lsCenter.y / texelSize) * texelSize;
+
+        Mat4 mtxProj = Mat4::Ortho2D(lsCenter.x - radius, lsCenter.x + radius,
+                                     lsCenter.y - radius, lsCenter.y + radius,
+                                     lsCenter.z - radius - casterDistance, lsCenter.z + radius);
+
+        cascade.SetViewProjection(mtxLight * mtxProj, Vec4(-lightDir, 0.0f), extent);
+
+        splitNear = splitFar;
+    }
+}
+
+CascadedShadowMap::Buffers CascadedShadowMap::buffers() const
+{
+    Buffers result;
+
+    for(int i = 0; i < CascadeCount; ++i)
+        result.cascades[i] = &cascades[i].buffer();
+
+    return result;
+}
+
+float CascadedShadowMap::Sample(const Vec3& worldPos, const Vec3& normal) const {
+    return buffers().Sample(worldPos, normal);
+}
+
+float CascadedShadowMap::Buffers::Sample(const Vec3& worldPos, const Vec3& normal) const
+{
+    float light;
+
+    for(auto cascade : cascades)
+    {
+        if(cascade->Sample(worldPos, normal, light))
+            return light;
+    }
+
+    return 1.0f;
+}
@@ -0,0 +1,168 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Math.h"
+#include "RenderBuffer.h"
+using namespace std;
+
+class Camera;
+class InstancedObject;
+class Model;
+class Scene;
+class SceneObject;
+
+// depth-only render target seen from a light. stores NDC depth (z/w),
+// cleared to 1 (far plane), where smaller values are closer to the light.
+class alignas(16) ShadowMap
+{
+public:
+    // the map is rendered into each of these in turn, so that a frame still being
+    // rasterized keeps sampling the buffer it was given while the next frame renders
+    static constexpr int BufferCount = 2;
+
+    // one rendering of the map, with the projection it was rendered with
+    class alignas(16) Buffer
+    {
+        friend class ShadowMap;
+
+        const ShadowMap* _owner = nullptr;
+        RenderBuffer<float> _depthBuffer;
+        uint32_t _size = 0;
+        Mat4 _mtxVP;
+        Vec4 _lightPos;
+        float _extent = 0;
+        bool _valid = false;
+
+        float Filter(float x, float y, float depth) const;
+
+    public:
+        // fraction of light reaching 'worldPos' (0 = shadowed, 1 = lit), filtered with a 3x3 tent PCF.
+        // returns false if the position is outside of the map.
+        bool Sample(const Vec3& worldPos, const Vec3& normal, float& light) const;
+        float Sample(const Vec3& worldPos, const Vec3& normal) const;
+    };
+
+    // an instanced object with instances inside the frustum, which are [first, last) of GetCasterInstances()
+    struct InstancedCaster
+    {
+        InstancedObject* obj;
+        uint32_t version;
+        size_t first;
+        size_t last;
+    };
+
+    // bias applied to the lookup position, in shadow map texels
+    float normalBias = 1.5f;
+    float depthBias = 1.0f;
+
+    ShadowMap();
+    ShadowMap(const ShadowMap&) = delete;
+    ShadowMap& operator=(const ShadowMap&) = delete;
+
+    void Resize(uint32_t size);
+    uint32_t size() const;
+
+    // 'lightPos' is the light position with w = 1, or the direction towards the light with w = 0.
+    // 'extent' is the world space width covered by the map at a clip space w of 1.
+    void SetViewProjection(const Mat4& mtxVP, const Vec4& lightPos, float extent);
+    const Mat4& GetVPMatrix() const;
+    bool CanSee(const Sphere& bounds) const;
+
+    // gathers the shadow casters inside the light's frustum and returns true
+    // if the map has to be re-rendered because the casters or the light changed.
+    // in that case the next buffer becomes current and has to be rendered into.
+    // the scene's bounding volume hierarchy has to be up to date.
+    bool UpdateCasters(const Scene& scene);
+    const vector<SceneObject*>& GetCasters() const;
+    const vector<InstancedCaster>& GetInstancedCasters() const;
+    const vector<uint32_t>& GetCasterInstances() const;
+    void Invalidate();
+
+    // depth buffer of the current buffer
+    RenderBuffer<float>& depthBuffer();
+
+    // the most recently rendered buffer
+    const Buffer& buffer() const;
+
+    bool Sample(const Vec3& worldPos, const Vec3& normal, float& light) const;
+    float Sample(const Vec3& worldPos, const Vec3& normal) const;
+
+private:
+    Buffer _buffers[BufferCount];
+    uint32_t _current;
+    uint32_t _size;
+    Mat4 _mtxVP;
+    Vec4 _lightPos;
+    float _extent;
+    Plane _frustum[6];
+
+    // state the depth buffer was rendered with
+    bool _valid;
+    Mat4 _renderedVP;
+    vector<uint32_t> _inFrustum; // object indices, kept to reuse the memory
+    // what a caster was rendered with, its model can be swapped or deformed in place
+    struct CasterVersion
+    {
+        const Model* model;
+        uint32_t modelVersion;
+        uint32_t transformVersion;
+
+        bool operator==(const CasterVersion& other) const {
+            return model == other.model && modelVersion == other.modelVersion && transformVersion == other.transformVersion;
+        }
+    };
+
+    vector<SceneObject*> _casters;
+    vector<CasterVersion> _casterVersions;
+    vector<SceneObject*> _renderedCasters;
+    vector<CasterVersion> _renderedVersions;
+    vector<InstancedCaster> _instancedCasters;
+    vector<uint32_t> _casterInstances;
+    vector<InstancedCaster> _renderedInstancedCasters;
+
+    bool InstancedCastersChanged() const;
+};
+
+// shadow maps covering consecutive depth ranges of the camera frustum for a directional light
+class alignas(16) CascadedShadowMap
+{
+public:
+    static constexpr int CascadeCount = 3;
+
+    ShadowMap cascades[CascadeCount];
+
+    // distance from the camera beyond which nothing is shadowed
+    float shadowDistance = 40.0f;
+
+    // how far behind the shadowed region casters are still picked up
+    float casterDistance = 50.0f;
+
+    // blend between uniform (0) and logarithmic (1) cascade splits
+    float splitBlend = 0.75f;
+
+    // the buffers of each cascade that a frame samples
+    struct Buffers
+    {
+        const ShadowMap::Buffer* cascades[CascadeCount];
+
+        float Sample(const Vec3& worldPos, const Vec3& normal) const;
+    };
+
+    CascadedShadowMap();
+
+    void Resize(uint32_t size);
+
+    // fits the cascades to the camera frustum as seen from a light shining along 'lightDir'
+    void Update(const Camera& camera, const Vec3& lightDir);
+
+    // the most recently rendered buffer of each cascade
+    Buffers buffers() const;
+
+    float Sample(const Vec3& worldPos, const Vec3& normal) const;
+};
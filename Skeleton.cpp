@@ -0,0 +1,114 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "Skeleton.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // scale, then rotation, then translation, for row vectors
+    Mat4 GetLocalMatrix(const BonePose& pose)
+    {
+        float x = pose.rotation[0];
+        float y = pose.rotation[1];
+        float z = pose.rotation[2];
+        float w = pose.rotation[3];
+        const float* s = pose.scale;
+        const float* t = pose.translation;
+
+        // the rows are the columns of the rotation matrix for column vectors
+        return Mat4(
+            (1 - 2 * (y * y + z * z)) * s[0], 2 * (x * y + w * z) * s[0],       2 * (x * z - w * y) * s[0],       0,
+            2 * (x * y - w * z) * s[1],       (1 - 2 * (x * x + z * z)) * s[1], 2 * (y * z + w * x) * s[1],       0,
+            2 * (x * z + w * y) * s[2],       2 * (y * z - w * x) * s[2],       (1 - 2 * (x * x + y * y)) * s[2], 0,
+            t[0],                             t[1],                             t[2],                             1);
+    }
+
+    void Blend(const BonePose& a, const BonePose& b, float t, BonePose& result)
+    {
+        for(int c = 0; c < 3; ++c)
+        {
+            result.translation[c] = a.translation[c] + (b.translation[c] - a.translation[c]) * t;
+            result.scale[c] = a.scale[c] + (b.scale[c] - a.scale[c]) * t;
+        }
+
+        // normalized lerp, the short way around
+        float dot = 0;
+        for(int c = 0; c < 4; ++c)
+            dot += a.rotation[c] * b.rotation[c];
+
+        float tb = dot < 0 ? -t : t;
+        float lengthSq = 0;
+
+        for(int c = 0; c < 4; ++c)
+        {
+            result.rotation[c] = a.rotation[c] * (1 - t) + b.rotation[c] * tb;
+            lengthSq += result.rotation[c] * result.rotation[c];
+        }
+
+        float invLength = lengthSq > 0 ? 1.0f / sqrt(lengthSq) : 0.0f;
+        for(int c = 0; c < 4; ++c)
+            result.rotation[c] *= invLength;
+    }
+}
+
+void Skeleton::GetSkinMatrices(const BonePose* pose, Mat4* globals, Mat4* matrices) const
+{
+    for(size_t b = 0; b < bones.size(); ++b)
+    {
+        const Bone& bone = bones[b];
+
+        globals[b] = GetLocalMatrix(pose[b]);
+        if(bone.parent >= 0)
+            globals[b] = globals[b] * globals[bone.parent];
+
+        matrices[b] = bone.offset * globals[b] * meshTransform;
+    }
+
+    matrices[bones.size()] = Mat4::identity;
+}
+
+void Skeleton::GetBindPose(BonePose* pose) const
+{
+    for(size_t b = 0; b < bones.size(); ++b)
+        pose[b] = bones[b].bindPose;
+}
+
+float AnimationClip::duration() const {
+    return (float)(frameCount - 1) / frameRate;
+}
+
+void AnimationClip::Sample(float time, bool loop, BonePose* pose) const
+{
+    float last = (float)(frameCount - 1);
+    float frame = time * frameRate;
+
+    if(loop && last > 0)
+    {
+        frame = fmod(frame, last);
+        if(frame < 0)
+            frame += last;
+    }
+    else
+    {
+        frame = Math::Clamp(frame, 0.0f, last);
+    }
+
+    int frame0 = min((int)frame, frameCount - 1);
+    int frame1 = min(frame0 + 1, frameCount - 1);
+    float t = frame - (float)frame0;
+
+    for(size_t b = 0; b < tracks.size(); ++b)
+    {
+        const Track& track = tracks[b];
+        const BonePose* trackKeys = &keys[track.firstKey];
+
+        if(track.keyCount == 1)
+            pose[b] = trackKeys[0];
+        else
+            Blend(trackKeys[frame0], trackKeys[frame1], t, pose[b]);
+    }
+}
@@ -0,0 +1,84 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Math.h"
+#include "Mem.h"
+using namespace std;
+
+// a bone's transform relative to its parent, in the space of the file the skeleton came from.
+// plain floats, so that clips take 40 bytes a key.
+struct BonePose
+{
+    float translation[3];
+    float rotation[4]; // quaternion, x y z w
+    float scale[3];
+};
+
+// the bones a vertex follows, up to 4, and how much it follows each of them.
+// the weights add up to 1, and unused ones are 0.
+struct SkinWeights
+{
+    float weights[4];
+    uint16_t bones[4];
+};
+
+// The bones of a skinned model, parents before their children.
+class Skeleton
+{
+public:
+    struct Bone
+    {
+        string name;
+        int parent;         // -1 for a root
+        BonePose bindPose;  // where the bone is when no clip is playing
+
+        // from the model's space to the bone's, as the skin was bound to it.
+        // identity for the bones that only carry others, and don't move any vertices themselves.
+        Mat4 offset;
+    };
+
+    vector<Bone, AlignedAllocator<Bone, 16>> bones;
+
+    // from the space the bones are in back to the model's
+    Mat4 meshTransform = Mat4::identity;
+
+    // the skin matrices of a pose with a transform for each bone, which move the model's vertices
+    // from where they were bound to where the pose puts them. 'matrices' gets one per bone, plus an
+    // identity for the vertices that don't follow any, and 'globals' is scratch space for one per bone.
+    void GetSkinMatrices(const BonePose* pose, Mat4* globals, Mat4* matrices) const;
+
+    // all of the bones in their bind pose
+    void GetBindPose(BonePose* pose) const;
+};
+
+// An animation of a skeleton's bones, sampled at a fixed rate when it's imported, so that
+// evaluating it is a blend between two keys, without searching for them. Bones that stay
+// still through the clip only keep one key.
+class AnimationClip
+{
+public:
+    struct Track
+    {
+        uint32_t firstKey;
+        uint32_t keyCount; // 1, or frameCount
+    };
+
+    string name;
+    float frameRate = 30.0f;
+    int frameCount = 1;
+
+    vector<Track> tracks; // by bone
+    vector<BonePose> keys;
+
+    float duration() const;
+
+    // the transforms of every bone 'time' seconds into the clip. the time wraps around
+    // if 'loop' is true, and stops at either end otherwise.
+    void Sample(float time, bool loop, BonePose* pose) const;
+};
@@ -0,0 +1,219 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "SkinnedObject.h"
+#include "JobSystem.h"
+#include "SIMD.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    // vertices per skinning job
+    const size_t ChunkSize = 4096;
+
+    struct Chunk
+    {
+        SkinnedObject* obj;
+        const Model* bindModel;
+        Model* model;
+        const Mat4* matrices;
+        size_t first;
+        size_t last;
+        Box bounds;
+    };
+
+    // moves the bind pose's vertices [first, last) by their bones into 'model'
+    void SkinVertices(Chunk& chunk)
+    {
+        const Vertex* src = chunk.bindModel->vertices.data();
+        const SkinWeights* skinWeights = chunk.bindModel->skinWeights.data();
+        Vertex* dst = chunk.model->vertices.data();
+        const Mat4* matrices = chunk.matrices;
+
+        const __m128 minNormalSq = _mm_set1_ps(1e-20f);
+        __m128 vmin = _mm_set1_ps(FLT_MAX);
+        __m128 vmax = _mm_set1_ps(-FLT_MAX);
+
+        for(size_t i = chunk.first; i < chunk.last; ++i)
+        {
+            const SkinWeights& skin = skinWeights[i];
+            const Mat4& m0 = matrices[skin.bones[0]];
+            const Mat4& m1 = matrices[skin.bones[1]];
+            const Mat4& m2 = matrices[skin.bones[2]];
+            const Mat4& m3 = matrices[skin.bones[3]];
+
+            __m128 w0 = _mm_set1_ps(skin.weights[0]);
+            __m128 w1 = _mm_set1_ps(skin.weights[1]);
+            __m128 w2 = _mm_set1_ps(skin.weights[2]);
+            __m128 w3 = _mm_set1_ps(skin.weights[3]);
+
+            // the weighted sum of the matrices, a row at a time. unused bones have a weight of 0.
+            __m128 rows[4];
+            for(int r = 0; r < 4; ++r)
+            {
+                rows[r] = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(m0.mm[r], w0), _mm_mul_ps(m1.mm[r], w1)),
+                    _mm_add_ps(_mm_mul_ps(m2.mm[r], w2), _mm_mul_ps(m3.mm[r], w3)));
+            }
+
+            __m128 p = _mm_load_ps(&src[i].position.x);
+            __m128 n = _mm_load_ps(&src[i].normal.x);
+
+            __m128 pos = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)), rows[0]),
+                           _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)), rows[1])),
+                _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)), rows[2]), rows[3]));
+
+            // positions are stored with a w of 0, like the model's
+            pos = _mm_blend_ps(pos, _mm_setzero_ps(), 0x8);
+
+            // the translation row is left out of the normal, whose w stays 0.
+            // non uniform scales aren't corrected for, like the rest of the renderer.
+            __m128 normal = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(n, n, _MM_SHUFFLE(0, 0, 0, 0)), rows[0]),
+                           _mm_mul_ps(_mm_shuffle_ps(n, n, _MM_SHUFFLE(1, 1, 1, 1)), rows[1])),
+                _mm_mul_ps(_mm_shuffle_ps(n, n, _MM_SHUFFLE(2, 2, 2, 2)), rows[2]));
+
+            normal = _mm_blend_ps(normal, _mm_setzero_ps(), 0x8);
+            __m128 lengthSq = _mm_max_ps(_mm_dp_ps(normal, normal, 0x7F), minNormalSq);
+            normal = _mm_div_ps(normal, _mm_sqrt_ps(lengthSq));
+
+            _mm_store_ps(&dst[i].position.x, pos);
+            _mm_store_ps(&dst[i].normal.x, normal);
+            _mm_store_ps(&dst[i].worldPos.x, pos);
+
+            vmin = _mm_min_ps(vmin, pos);
+            vmax = _mm_max_ps(vmax, pos);
+        }
+
+        chunk.bounds.vmin = Vec3(vmin);
+        chunk.bounds.vmax = Vec3(vmax);
+    }
+}
+
+SkinnedObject::SkinnedObject(const shared_ptr<SceneObject>& object)
+{
+    if(!object->model || !object->model->skinned())
+        throw runtime_error("Model isn't skinned.");
+
+    this->object = object;
+    _bindModel = object->model;
+    _current = 0;
+    _posed = false;
+
+    const Model& bindModel = *_bindModel;
+    size_t boneCount = bindModel.skeleton.bones.size();
+
+    _pose.resize(boneCount);
+    _lastPose.resize(boneCount);
+    _globals.resize(boneCount);
+    _matrices.resize(boneCount + 1);
+
+    // only what drawing needs, the copies aren't skinned themselves
+    for(auto& model : _models)
+    {
+        model = AlignedMakeShared<Model, 16>();
+        model->vertices = bindModel.vertices;
+        model->lodSize = bindModel.lodSize;
+        model->lodHysteresis = bindModel.lodHysteresis;
+        model->defaultTransfrom = bindModel.defaultTransfrom;
+        model->hasLightmapCoords = bindModel.hasLightmapCoords;
+        model->lightmapGridSize = bindModel.lightmapGridSize;
+        model->bbox = bindModel.bbox;
+        model->bsphere = bindModel.bsphere;
+    }
+}
+
+bool SkinnedObject::Pose()
+{
+    const Model& bindModel = *_bindModel;
+
+    if(animation >= 0 && animation < (int)bindModel.animations.size())
+        bindModel.animations[animation].Sample(time, loop, _pose.data());
+    else
+        bindModel.skeleton.GetBindPose(_pose.data());
+
+    if(_posed && memcmp(_pose.data(), _lastPose.data(), _pose.size() * sizeof(BonePose)) == 0)
+        return false;
+
+    _lastPose = _pose;
+    _posed = true;
+
+    bindModel.skeleton.GetSkinMatrices(_pose.data(), _globals.data(), _matrices.data());
+    _current = (_current + 1) % ModelCount;
+    return true;
+}
+
+void SkinnedObject::Update(const vector<shared_ptr<SkinnedObject>>& objects, float deltaTime, JobSystem& jobSystem)
+{
+    for(auto& obj : objects)
+        obj->time += deltaTime * obj->speed;
+
+    // kept from one update to the next, so a frame doesn't allocate them again. per thread,
+    // since each rendering context updates its objects on the thread that draws it. the jobs
+    // use them through references, or they'd see the copies of the threads they run on.
+    static thread_local vector<char> posedStorage;
+    static thread_local vector<Chunk> chunkStorage;
+    vector<char>& posed = posedStorage;
+    vector<Chunk>& chunks = chunkStorage;
+
+    // sampling the clips and walking the bones is done per object
+    posed.assign(objects.size(), 0);
+
+    jobSystem.ParallelFor(objects.size(), [&](size_t i) {
+        posed[i] = objects[i]->Pose();
+    });
+
+    chunks.clear();
+
+    for(size_t i = 0; i < objects.size(); ++i)
+    {
+        if(!posed[i])
+            continue;
+
+        SkinnedObject* obj = objects[i].get();
+        size_t vertexCount = obj->_bindModel->vertices.size();
+
+        for(size_t first = 0; first < vertexCount; first += ChunkSize)
+        {
+            Chunk chunk;
+            chunk.obj = obj;
+            chunk.bindModel = obj->_bindModel.get();
+            chunk.model = obj->_models[obj->_current].get();
+            chunk.matrices = obj->_matrices.data();
+            chunk.first = first;
+            chunk.last = min(first + ChunkSize, vertexCount);
+            chunks.push_back(chunk);
+        }
+    }
+
+    jobSystem.ParallelFor(chunks.size(), [&](size_t i) {
+        SkinVertices(chunks[i]);
+    });
+
+    // each object's chunks are next to each other
+    for(size_t i = 0; i < chunks.size(); )
+    {
+        SkinnedObject* obj = chunks[i].obj;
+        Model& model = *chunks[i].model;
+        Box bounds = chunks[i].bounds;
+
+        for(++i; i < chunks.size() && chunks[i].obj == obj; ++i)
+        {
+            const Box& b = chunks[i].bounds;
+            bounds.vmin = Vec3(min(bounds.vmin.x, b.vmin.x), min(bounds.vmin.y, b.vmin.y), min(bounds.vmin.z, b.vmin.z));
+            bounds.vmax = Vec3(max(bounds.vmax.x, b.vmax.x), max(bounds.vmax.y, b.vmax.y), max(bounds.vmax.z, b.vmax.z));
+        }
+
+        model.bbox = bounds;
+        model.bsphere = Sphere((bounds.vmin + bounds.vmax) * 0.5f, (bounds.vmax - bounds.vmin).Length() * 0.5f);
+        model.VerticesChanged();
+
+        obj->object->model = obj->_models[obj->_current];
+    }
+}
@@ -0,0 +1,70 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Math.h"
+#include "Mem.h"
+#include "RenderingContext.h"
+#include "SceneObject.h"
+#include "Skeleton.h"
+using namespace std;
+
+class JobSystem;
+
+// Plays the animations of a skinned model on a scene object.
+//
+// The object's model is the bind pose, and is kept. Every update, the clip is sampled, and the
+// bind pose's vertices are moved by the bones they follow into a copy, which becomes the object's
+// model. The copies are taken in turn from one more than the rendering context can have in flight,
+// so the one being written is never one a frame is still drawing. Poses that didn't change since
+// the last update, like a clip that ended, keep the copy they were already in.
+//
+// The vertices are skinned one at a time, as they're stored. Each blends the rows of its bones'
+// matrices by its weights, and is transformed by the blend, with a row or a vector in each SSE
+// register. The vertices of every object are split into chunks that go to different threads.
+class alignas(16) SkinnedObject
+{
+public:
+    shared_ptr<SceneObject> object;
+
+    // into the model's animations, or -1 for the bind pose
+    int animation = 0;
+
+    // seconds into the animation, advanced by deltaTime * speed every update
+    float time = 0.0f;
+    float speed = 1.0f;
+    bool loop = true;
+
+    // 'object' has to have a skinned model, see Model::skinned()
+    explicit SkinnedObject(const shared_ptr<SceneObject>& object);
+
+    const shared_ptr<Model>& bindModel() const {
+        return _bindModel;
+    }
+
+    // poses the objects, once per frame before drawing it, on the thread that calls Draw()
+    static void Update(const vector<shared_ptr<SkinnedObject>>& objects, float deltaTime, JobSystem& jobSystem);
+
+private:
+    typedef vector<Mat4, AlignedAllocator<Mat4, 16>> MatrixList;
+
+    static constexpr int ModelCount = RenderingContext::MaxFramesInFlight + 1;
+
+    shared_ptr<Model> _bindModel;
+    shared_ptr<Model> _models[ModelCount];
+    int _current;
+
+    vector<BonePose> _pose;
+    vector<BonePose> _lastPose;
+    bool _posed;
+
+    MatrixList _globals;
+    MatrixList _matrices;
+
+    bool Pose();
+};
@@ -6,9 +6,15 @@
 #pragma once
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <exception>
+#include <stdexcept>
+#include <vector>
+#include "ColorConversion.h"
+#include "JobSystem.h"
+#include "MappedFile.h"
 #include "Math.h"
 using namespace std;
 
@@ -74,130 +80,245 @@ public:
     TargaImage(unique_ptr<Color32[]>&& pixels, int width, int height, int channels)
         : pixels(std::forward<unique_ptr<Color32[]>>(pixels)), width(width), height(height), channels(channels){}
 
-    static TargaImage Load(const string& filename)
+    // the size of the image in a TGA file in memory.
+    // throws runtime_error if it isn't an image that can be decoded.
+    static void ReadInfo(const uint8_t* data, size_t size, int& width, int& height, int& channels)
     {
-        ifstream fin(filename, ios::in | ios::binary);
-        if(!fin)
-            throw runtime_error("Failed to load file.");
+        size_t pixelOffset;
+        TargaHeader hdr = ReadHeader(data, size, pixelOffset);
 
-        auto sz = sizeof(TargaHeader);
-
-        uint8_t hdrBytes[18];
-        if(!fin.read((char*)hdrBytes, sizeof(hdrBytes)))
-            throw TargaReadError();
+        width = hdr.imageWidth;
+        height = hdr.imageHeight;
+        channels = hdr.imageBitDepth / 8;
+    }
 
-        TargaHeader hdr = TargaHeader::Unpack(hdrBytes);
+    // decodes a TGA file in memory into 'pixels', which has room for the whole image, top row first.
+    // rows are written straight to where they go, so images stored bottom up aren't flipped afterwards.
+    // large images are decoded in bands of rows on 'jobSystem', if there is one. RLE packets can run
+    // from one row to the next, so their headers are scanned first to find where each band starts.
+    static void Decode(const uint8_t* data, size_t size, Color32* pixels, JobSystem* jobSystem = nullptr)
+    {
+        size_t pixelOffset;
+        TargaHeader hdr = ReadHeader(data, size, pixelOffset);
 
-        bool hasColorMap = (hdr.colorMapType & 1) != 0;
-        TargaType type = hdr.imageType;
+        int w = hdr.imageWidth;
+        int h = hdr.imageHeight;
         int bytesPerPixel = hdr.imageBitDepth / 8;
-        
-        if(type != TargaType::TrueColor
-           && type != TargaType::TrueColorRLE)
-            throw runtime_error("Invalid file format. Only true-color TGA files are supported.");
+        bool bottomUp = (hdr.imageDescriptor & 0b100000) == 0;
+        size_t totalPixels = (size_t)w * h;
 
-        if(hdr.imageBitDepth != 24
-        && hdr.imageBitDepth != 32)
-            throw runtime_error("Invalid file format. Only 24 and 32 bit files are supported.");
+        auto getRow = [=](int y) {
+            return pixels + (size_t)(bottomUp ? h - 1 - y : y) * w;
+        };
+
+        int bandRows = GetBandRows(w, h, jobSystem);
+        size_t bandCount = (h + bandRows - 1) / bandRows;
+
+        if(hdr.imageType == TargaType::TrueColor)
+        {
+            size_t stride = (size_t)w * bytesPerPixel;
+            if(totalPixels * bytesPerPixel > size - pixelOffset)
+                throw TargaReadError();
+
+            ForEachBand(jobSystem, bandCount, [=](size_t band)
+            {
+                int y1 = (int)band * bandRows;
+                int y2 = min(y1 + bandRows, h);
+
+                for(int y = y1; y < y2; ++y)
+                    ColorConversion::Convert(data + pixelOffset + y * stride, bytesPerPixel, getRow(y), w);
+            });
 
-        if(hdr.idLength > 0)
-            fin.ignore(hdr.idLength);
+            return;
+        }
 
-        if(hdr.colorMapLength > 0)
-            fin.ignore(hdr.colorMapLength * (hdr.colorMapBitDepth / 8));
+        // where the first packet of each band is, and how many of its pixels belong to the band before
+        struct BandStart
+        {
+            size_t offset;
+            size_t skip;
+        };
 
-        int totalPixels = hdr.imageWidth * hdr.imageHeight;
-        unique_ptr<Color32[]> data = make_unique<Color32[]>(totalPixels);
+        vector<BandStart> starts(bandCount);
+        size_t band = 0;
+        size_t pos = pixelOffset;
+        size_t pixel = 0;
 
-        if(type == TargaType::TrueColor)
+        while(pixel < totalPixels)
         {
-            unique_ptr<uint8_t[]> tmp = make_unique<uint8_t[]>(totalPixels * bytesPerPixel);
-            if(!fin.read((char*)tmp.get(), totalPixels * bytesPerPixel))
+            if(pos >= size)
                 throw TargaReadError();
 
-            int count = 0;
+            uint8_t chunkHdr = data[pos];
+            bool isRLE = (chunkHdr & 0b10000000) != 0;
+            size_t chunkLength = (chunkHdr & 0b01111111) + 1;
+            size_t chunkSize = 1 + (isRLE ? 1 : chunkLength) * bytesPerPixel;
 
-            for(int i = 0; i < totalPixels; ++i)
-            {
-                uint8_t bgra[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
-                memcpy(bgra, &tmp[i * bytesPerPixel], bytesPerPixel);
-                data[count++] = { bgra[2], bgra[1], bgra[0], bgra[3] };
-            }
+            if(chunkSize > size - pos)
+                throw TargaReadError();
+
+            for(; band < bandCount && band * bandRows * w < pixel + chunkLength; ++band)
+                starts[band] = { pos, band * bandRows * w - pixel };
+
+            pixel += chunkLength;
+            pos += chunkSize;
         }
-        else if(type == TargaType::TrueColorRLE)
+
+        ForEachBand(jobSystem, bandCount, [&](size_t band)
         {
-            int count = 0;
+            int y = (int)band * bandRows;
+            int yEnd = min(y + bandRows, h);
+            int x = 0;
+            Color32* row = getRow(y);
 
-            while(count < totalPixels)
-            {
-                uint8_t chunkHdr;
-                if(!fin.read((char*)&chunkHdr, 1))
-                    throw TargaReadError();
+            size_t pos = starts[band].offset;
+            size_t skip = starts[band].skip;
 
+            // the packets are all in the file, as checked above
+            while(y < yEnd)
+            {
+                uint8_t chunkHdr = data[pos++];
                 bool isRLE = (chunkHdr & 0b10000000) != 0;
-                int chunkLength = (chunkHdr & 0b01111111) + 1;
+                size_t remaining = (chunkHdr & 0b01111111) + 1 - skip;
 
-                if(isRLE)
-                {
-                    uint8_t bgra[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
-                    if(!fin.read((char*)bgra, bytesPerPixel))
-                        throw TargaReadError();
+                Color32 pixel = ColorConversion::Read(data + pos, bytesPerPixel);
+                const uint8_t* src = data + pos + skip * bytesPerPixel;
+                pos += isRLE ? bytesPerPixel : (remaining + skip) * bytesPerPixel;
+                skip = 0;
 
-                    Color32 pixel = { bgra[2], bgra[1], bgra[0], bgra[3] };
-                    for(int i = 0; i < chunkLength; ++i)
-                        data[count++] = pixel;
-                }
-                else
+                // packets may continue on the next rows
+                while(remaining > 0 && y < yEnd)
                 {
-                    uint8_t tmp[128 * 4];
-                    if(!fin.read((char*)tmp, bytesPerPixel * chunkLength))
-                        throw TargaReadError();
+                    size_t count = min(remaining, (size_t)(w - x));
+
+                    if(isRLE)
+                    {
+                        ColorConversion::Fill(row + x, pixel, count);
+                    }
+                    else
+                    {
+                        ColorConversion::Convert(src, bytesPerPixel, row + x, count);
+                        src += count * bytesPerPixel;
+                    }
 
-                    uint8_t* src = tmp;
+                    remaining -= count;
+                    x += (int)count;
 
-                    for(int i = 0; i < chunkLength; ++i)
+                    if(x == w && ++y < yEnd)
                     {
-                        uint8_t bgra[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
-                        std::copy(src, src + bytesPerPixel, bgra);
-                        data[count++] = { bgra[2], bgra[1], bgra[0], bgra[3] };
-                        src += bytesPerPixel;
+                        x = 0;
+                        row = getRow(y);
                     }
                 }
             }
-        }
+        });
 
-        bool vflipped = (hdr.imageDescriptor & 0b10000) == 0;
-        if(vflipped)
-        {
-            int h = hdr.imageHeight;
-            int w = hdr.imageWidth;
+        // ignore extension section
+        // ignore footer section
+    }
 
-            for(size_t y1 = 0, ye = h / 2;
-                y1 < ye; ++y1)
-            {
-                size_t y2 = h - y1 - 1;
+    static TargaImage Load(const string& filename, JobSystem* jobSystem = nullptr)
+    {
+        MappedFile file(filename);
 
-                uint32_t *r1_beg = (uint32_t*)data.get() + y1 * w;
-                uint32_t *r1_end = r1_beg + w;
+        int w, h, channels;
+        ReadInfo(file.data(), file.size(), w, h, channels);
 
-                uint32_t *r2_beg = (uint32_t*)data.get() + y2 * w;
-                uint32_t *r2_end = r2_beg + w;
+        unique_ptr<Color32[]> data = make_unique<Color32[]>((size_t)w * h);
+        Decode(file.data(), file.size(), data.get(), jobSystem);
 
-                while(r1_beg != r1_end)
-                {
-                    uint32_t p = *r1_beg;
-                    *r1_beg = *r2_beg;
-                    *r2_beg = p;
+        return { std::forward<unique_ptr<Color32[]>>(data), w, h, channels };
+    }
 
-                    ++r1_beg;
-                    ++r2_beg;
-                }
+    // writes an uncompressed 32 bit image with rows stored bottom to top
+    void Save(const string& filename) const
+    {
+        ofstream fout(filename, ios::out | ios::binary);
+        if(!fout)
+            throw runtime_error("Failed to create file.");
+
+        uint8_t hdrBytes[18] = {};
+        hdrBytes[2] = (uint8_t)TargaType::TrueColor;
+        hdrBytes[12] = (uint8_t)(width & 0xFF);
+        hdrBytes[13] = (uint8_t)(width >> 8);
+        hdrBytes[14] = (uint8_t)(height & 0xFF);
+        hdrBytes[15] = (uint8_t)(height >> 8);
+        hdrBytes[16] = 32;
+        hdrBytes[17] = 8; // alpha depth
+
+        unique_ptr<uint8_t[]> tmp = make_unique<uint8_t[]>(width * height * 4);
+        uint8_t* dst = tmp.get();
+
+        for(int y = height - 1; y >= 0; --y)
+        {
+            const Color32* src = pixels.get() + y * width;
+
+            for(int x = 0; x < width; ++x, dst += 4)
+            {
+                dst[0] = src[x].b;
+                dst[1] = src[x].g;
+                dst[2] = src[x].r;
+                dst[3] = src[x].a;
             }
         }
 
-        // ignore extension section
-        // ignore footer section
+        if(!fout.write((char*)hdrBytes, sizeof(hdrBytes))
+        || !fout.write((char*)tmp.get(), width * height * 4))
+            throw runtime_error("Failed to write image data.");
+    }
+
+private:
+    static TargaHeader ReadHeader(const uint8_t* data, size_t size, size_t& pixelOffset)
+    {
+        uint8_t hdrBytes[18];
+        if(size < sizeof(hdrBytes))
+            throw TargaReadError();
+
+        memcpy(hdrBytes, data, sizeof(hdrBytes));
+        TargaHeader hdr = TargaHeader::Unpack(hdrBytes);
+
+        TargaType type = hdr.imageType;
+
+        if(type != TargaType::TrueColor
+           && type != TargaType::TrueColorRLE)
+            throw runtime_error("Invalid file format. Only true-color TGA files are supported.");
 
-        return { std::forward<unique_ptr<Color32[]>>(data), hdr.imageWidth, hdr.imageHeight, bytesPerPixel };
+        if(hdr.imageBitDepth != 24
+        && hdr.imageBitDepth != 32)
+            throw runtime_error("Invalid file format. Only 24 and 32 bit files are supported.");
+
+        if(hdr.imageWidth == 0 || hdr.imageHeight == 0)
+            throw runtime_error("Invalid file format. The image is empty.");
+
+        pixelOffset = sizeof(hdrBytes) + hdr.idLength + hdr.colorMapLength * (hdr.colorMapBitDepth / 8);
+        if(pixelOffset > size)
+            throw TargaReadError();
+
+        return hdr;
+    }
+
+    // images smaller than a few bands aren't worth splitting up
+    static int GetBandRows(int w, int h, JobSystem* jobSystem)
+    {
+        if(!jobSystem)
+            return h;
+
+        const size_t MinBandPixels = 64 * 1024;
+        size_t threadCount = jobSystem->threadCount();
+
+        size_t bandCount = min((size_t)w * h / MinBandPixels, threadCount * 4);
+        if(threadCount == 1 || bandCount <= 1)
+            return h;
+
+        return (int)((h + bandCount - 1) / bandCount);
+    }
+
+    template<class Function>
+    static void ForEachBand(JobSystem* jobSystem, size_t bandCount, const Function& function)
+    {
+        if(bandCount == 1)
+            function(0);
+        else
+            jobSystem->ParallelFor(bandCount, function);
     }
 };
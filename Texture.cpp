@@ -7,6 +7,7 @@
 #include "RenderingContext.h"
 #include "TargaImage.h"
 #include "BitmapImage.h"
+#include "MappedFile.h"
 #include "SIMD.h"
 #include <fstream>
 #include <string>
@@ -14,34 +15,67 @@
 #include <algorithm>
 using namespace std;
 
-Texture::Texture(const string &filename, FilterMode filterMode)
+Texture::Texture(const string &filename, FilterMode filterMode, JobSystem* jobSystem)
 {
-    unique_ptr<Color32[]> tmp;
-    
     string ext = filename.substr(filename.find_last_of('.'));
     for(auto& c : ext) c = tolower(c);
 
-    if(ext == ".bmp")
-    {
-        auto img = BitmapImage::Load(filename);
-        tmp = move(img.pixels);
-        _width = img.width;
-        _height = img.height;
-        _channels = img.channels;
-    }
-    else if(ext == ".tga")
-    {
-        auto img = TargaImage::Load(filename);
-        tmp = move(img.pixels);
-        _width = img.width;
-        _height = img.height;
-        _channels = img.channels;
-    }
-    else
-    {
+    bool isBitmap = ext == ".bmp";
+
+    if(!isBitmap && ext != ".tga")
         throw runtime_error("Invalid file type. Only 24 and 32 bit BMP and TGA files are supported.");
-    }
 
+    MappedFile file(filename);
+    int width, height, channels;
+
+    if(isBitmap)
+        BitmapImage::ReadInfo(file.data(), file.size(), width, height, channels);
+    else
+        TargaImage::ReadInfo(file.data(), file.size(), width, height, channels);
+
+    _width = width;
+    _height = height;
+    _channels = channels;
+    AllocateMipmaps();
+
+    // decoded straight into the first mipmap
+    if(isBitmap)
+        BitmapImage::Decode(file.data(), file.size(), _mipmaps[0].pixels, jobSystem);
+    else
+        TargaImage::Decode(file.data(), file.size(), _mipmaps[0].pixels, jobSystem);
+
+    GenerateMipmaps();
+    _filterMode = filterMode;
+    _mipmapBias = 0.0f;
+}
+
+Texture::Texture(const Color32* pixels, uint32_t width, uint32_t height, FilterMode filterMode)
+{
+    _width = width;
+    _height = height;
+    _channels = 4;
+
+    AllocateMipmaps();
+    std::copy(pixels, pixels + width * height, _mipmaps[0].pixels);
+
+    GenerateMipmaps();
+    _filterMode = filterMode;
+    _mipmapBias = 0.0f;
+}
+
+Texture::Texture(const vector<Mipmap>& mipmaps, uint32_t channels, FilterMode filterMode, shared_ptr<const void> owner)
+{
+    _mipmaps = mipmaps;
+    _owner = move(owner);
+    _width = (uint32_t)mipmaps[0].width;
+    _height = (uint32_t)mipmaps[0].height;
+    _channels = channels;
+    _filterMode = filterMode;
+    _mipmapBias = 0.0f;
+}
+
+void Texture::AllocateMipmaps()
+{
     int pixelCount = 0;
     int w = (int)_width;
     int h = (int)_height;
@@ -64,21 +98,21 @@ Texture::Texture(const string &filename, FilterMode filterMode)
 
     for(auto& mip : _mipmaps)
     {
-        int count = mip.width * mip.height;
-        for(int i = 0; i < count; ++i)
-            pPixels[i] = tmp[i];
-
         mip.pixels = pPixels;
-
-        MipDown(tmp.get(), mip.width, mip.height);
-        pPixels += count;
+        pPixels += mip.width * mip.height;
     }
+}
 
-    _filterMode = filterMode;
-    _mipmapBias = 0.0f;
+void Texture::GenerateMipmaps()
+{
+    for(size_t i = 1; i < _mipmaps.size(); ++i)
+    {
+        const Mipmap& src = _mipmaps[i - 1];
+        MipDown(src.pixels, src.width, src.height, _mipmaps[i].pixels);
+    }
 }
 
-void Texture::MipDown(Color32* pixels, int w, int h)
+void Texture::MipDown(const Color32* pixels, int w, int h, Color32* dest)
 {
     if(w > 1 && h > 1)
     {
@@ -89,7 +123,7 @@ void Texture::MipDown(Color32* pixels, int w, int h)
         {
             for(int x = 0; x < destWidth; ++x)
             {
-                Color32* p = pixels + ((y * 2) * w + (x * 2));
+                const Color32* p = pixels + ((y * 2) * w + (x * 2));
 
                 uint32_t r = p->r;
                 uint32_t g = p->g;
@@ -114,18 +148,17 @@ void Texture::MipDown(Color32* pixels, int w, int h)
                 b += p->b;
                 a += p->a;
 
-                pixels[y * destWidth + x] = Color32(r >> 2, g >> 2, b >> 2, a >> 2);
+                dest[y * destWidth + x] = Color32(r >> 2, g >> 2, b >> 2, a >> 2);
             }
         }
     }
     else if(w > 1)
     {
         int destWidth = w >> 1;
-        int destHeight = h;
 
         for(int x = 0; x < destWidth; ++x)
         {
-            Color32* p = pixels + (x * 2);
+            const Color32* p = pixels + (x * 2);
             
             uint32_t r = p->r;
             uint32_t g = p->g;
@@ -138,17 +171,16 @@ void Texture::MipDown(Color32* pixels, int w, int h)
             b += p->b;
             a += p->a;
 
-            pixels[destWidth + x] = Color32(r >> 1, g >> 1, b >> 1, a >> 1);
+            dest[x] = Color32(r >> 1, g >> 1, b >> 1, a >> 1);
         }
     }
     else if(h > 1)
     {
-        int destWidth = w;
         int destHeight = h >> 1;
 
         for(int y = 0; y < destHeight; ++y)
         {
-            Color32* p = pixels + (y * 2);
+            const Color32* p = pixels + (y * 2);
 
             uint32_t r = p->r;
             uint32_t g = p->g;
@@ -161,7 +193,7 @@ void Texture::MipDown(Color32* pixels, int w, int h)
             b += p->b;
             a += p->a;
 
-            pixels[destHeight + y] = Color32(r >> 1, g >> 1, b >> 1, a >> 1);
+            dest[y] = Color32(r >> 1, g >> 1, b >> 1, a >> 1);
         }
     }
 }
@@ -4,7 +4,6 @@
 *--------------------------------------------------------------------------------------------*/
 
 #pragma once
-#include <Windows.h>
 #include <string>
 #include <cassert>
 #include <cstdint>
@@ -14,6 +13,7 @@
 #include "Mem.h"
 using namespace std;
 
+class JobSystem;
 class RenderingContext;
 
 class Mipmap
@@ -35,6 +35,7 @@ class Texture
 {
     unique_ptr<Color32[], AlignedDeleter<Color32>> _pixels;
     vector<Mipmap> _mipmaps;
+    shared_ptr<const void> _owner; // of the mipmaps' pixels, when they aren't in _pixels
     
     uint32_t _width;
     uint32_t _height;
@@ -42,10 +43,21 @@ class Texture
     FilterMode _filterMode;
     float _mipmapBias;
 
-    static void MipDown(Color32* pixels, int w, int h);
+    // averages 'pixels' down to half the size into 'dest'
+    static void MipDown(const Color32* pixels, int w, int h, Color32* dest);
+
+    // lays out the mipmaps down to 1x1 in _pixels, for the first one to be filled in
+    void AllocateMipmaps();
+    void GenerateMipmaps();
 
 public:
-    Texture(const string &filename, FilterMode filterMode);
+    // large images are decoded on 'jobSystem', if there is one
+    Texture(const string &filename, FilterMode filterMode, JobSystem* jobSystem = nullptr);
+    Texture(const Color32* pixels, uint32_t width, uint32_t height, FilterMode filterMode);
+
+    // mipmaps that are already in memory, down to 1x1, like those of an AssetPack.
+    // they're used where they are, and 'owner' is kept alive as long as the texture.
+    Texture(const vector<Mipmap>& mipmaps, uint32_t channels, FilterMode filterMode, shared_ptr<const void> owner);
     ~Texture();
 
     Color GetPixel(const Vec2 &uv, float mipLevel = 0);
@@ -67,5 +79,6 @@ public:
     }
     
     int mipmapCount() const { return (int)_mipmaps.size(); }
+    const Mipmap& mipmap(int mipLevel) const { return _mipmaps[mipLevel]; }
     float mipmapBias() const { return _mipmapBias; }
 };
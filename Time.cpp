@@ -12,8 +12,7 @@ Time& Time::that() {
 
 Time::Time()
 {
-    QueryPerformanceFrequency((LARGE_INTEGER*)&_frequency);
-    QueryPerformanceCounter((LARGE_INTEGER*)&_initTime);
+    _initTime = Clock::now();
     _then = _initTime;
     _lastDeltaTime = 0;
     _lastFPSUpdate = _initTime;
@@ -23,15 +22,14 @@ Time::Time()
 
 void Time::update()
 {
-    long long now;
-    QueryPerformanceCounter((LARGE_INTEGER*)&now);
+    Clock::time_point now = Clock::now();
 
     Time& t = that();
     
-    t._lastDeltaTime = (float)(now - t._then) / (float)t._frequency;
+    t._lastDeltaTime = std::chrono::duration<float>(now - t._then).count();
     t._then = now;
 
-    if(now - t._lastFPSUpdate >= t._frequency)
+    if(now - t._lastFPSUpdate >= std::chrono::seconds(1))
     {
         t._lastFPSUpdate = now;
         t._lastFps = t._frames;
@@ -45,10 +43,7 @@ float Time::time()
 {
     Time& t = that();
 
-    long long now;
-    QueryPerformanceCounter((LARGE_INTEGER*)&now);
-
-    return (float)(now - t._initTime) / (float)t._frequency;
+    return std::chrono::duration<float>(Clock::now() - t._initTime).count();
 }
 
 uint32_t Time::fps()
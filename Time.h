@@ -5,18 +5,19 @@
 
 #pragma once
 #include <cstdint>
-#include <Windows.h>
+#include <chrono>
 
 class Time
 {
     static Time& that();
 
-    long long _frequency;
-    long long _initTime;
-    long long _then;
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point _initTime;
+    Clock::time_point _then;
     float _lastDeltaTime;
 
-    long long _lastFPSUpdate;
+    Clock::time_point _lastFPSUpdate;
     uint32_t _frames;
     uint32_t _lastFps;
 
@@ -12,7 +12,8 @@ Transform::Transform()
     _matrix(Mat4::identity),
     _inverseMatrix(Mat4::identity),
     _matrixDirty(false),
-    _inverseDirty(false)
+    _inverseDirty(false),
+    _version(0)
 {
     
 }
@@ -83,6 +84,11 @@ Vec3 Transform::Forward()
     return Vec3::forward * _rotation;
 }
 
+uint32_t Transform::GetVersion() const
+{
+    return _version;
+}
+
 void Transform::AddObserver(ITransformObserver *observer)
 {
     _observers.push_back(observer);
@@ -106,6 +112,7 @@ void Transform::SetDirty()
 {
     _matrixDirty = true;
     _inverseDirty = true;
+    ++_version;
 
     for(uint32_t i = 0; i < _observers.size(); ++i)
     {
@@ -41,6 +41,9 @@ public:
     const Mat4& GetMatrix() const;
     const Mat4& GetInverseMatrix() const;
 
+    // incremented every time the transform changes
+    uint32_t GetVersion() const;
+
     void AddObserver(ITransformObserver *observer);
     void RemoveObserver(ITransformObserver *observer);
 
@@ -53,6 +56,7 @@ private:
     mutable Mat4 _inverseMatrix;
     mutable bool _matrixDirty;
     mutable bool _inverseDirty;
+    uint32_t _version;
 
     vector<ITransformObserver*> _observers;
 
@@ -14,21 +14,26 @@ public:
     Vec4 position;
     Vec3 normal;
     Vec2 texcoord;
+    Vec2 lightmapCoord;
     Vec3 worldPos;
 
     Vertex(){}
 
     Vertex(const Vec4 &pos, const Vec3 &norm, const Vec2 &tex)
-        : position(pos), normal(norm), texcoord(tex), worldPos(pos){}
+        : position(pos), normal(norm), texcoord(tex), lightmapCoord(tex), worldPos(pos){}
 
     Vertex(const Vec4 &pos, const Vec3 &norm, const Vec2 &tex, const Vec3& worldPos)
-        : position(pos), normal(norm), texcoord(tex), worldPos(worldPos){}
+        : position(pos), normal(norm), texcoord(tex), lightmapCoord(tex), worldPos(worldPos){}
+
+    Vertex(const Vec4 &pos, const Vec3 &norm, const Vec2 &tex, const Vec2 &lightmapCoord, const Vec3& worldPos)
+        : position(pos), normal(norm), texcoord(tex), lightmapCoord(lightmapCoord), worldPos(worldPos){}
 
     Vertex operator+(const Vertex &other) const
     {
         return Vertex(position + other.position,
                       normal   + other.normal,
                       texcoord + other.texcoord,
+                      lightmapCoord + other.lightmapCoord,
                       worldPos + other.worldPos);
     }
 
@@ -37,6 +42,7 @@ public:
         return Vertex(position - other.position,
                       normal   - other.normal,
                       texcoord - other.texcoord,
+                      lightmapCoord - other.lightmapCoord,
                       worldPos - other.worldPos);
     }
 
@@ -45,6 +51,7 @@ public:
         return Vertex(position * scale,
                       normal   * scale,
                       texcoord * scale,
+                      lightmapCoord * scale,
                       worldPos * scale);
     }
 
@@ -54,6 +61,7 @@ public:
         return Vertex(position * num,
                       normal   * num,
                       texcoord * num,
+                      lightmapCoord * num,
                       worldPos * num);
     }
 
@@ -62,6 +70,7 @@ public:
         position += other.position;
         normal   += other.normal;
         texcoord += other.texcoord;
+        lightmapCoord += other.lightmapCoord;
         worldPos += other.worldPos;
         return *this;
     }
@@ -71,6 +80,7 @@ public:
         position -= other.position;
         normal   -= other.normal;
         texcoord -= other.texcoord;
+        lightmapCoord -= other.lightmapCoord;
         worldPos -= other.worldPos;
         return *this;
     }
@@ -80,6 +90,7 @@ public:
         position *= scale;
         normal   *= scale;
         texcoord *= scale;
+        lightmapCoord *= scale;
         worldPos *= scale;
         return *this;
     }
@@ -90,6 +101,7 @@ public:
         position *= num;
         normal   *= num;
         texcoord *= num;
+        lightmapCoord *= num;
         worldPos *= num;
         return *this;
     }
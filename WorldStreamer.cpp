@@ -0,0 +1,448 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "WorldStreamer.h"
+#include "AssetPack.h"
+#include "Model.h"
+#include "RenderingContext.h"
+#include "Scene.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace
+{
+    uint64_t GetCellKey(int x, int z) {
+        return (uint64_t)(uint32_t)x << 32 | (uint32_t)z;
+    }
+
+    size_t GetMemorySize(const Model& model)
+    {
+        size_t size = model.vertices.size() * sizeof(Vertex);
+
+        for(auto& lod : model.lods)
+            size += lod.size() * sizeof(Vertex);
+
+        for(auto& lod : model.packedLods)
+            size += lod.size() * sizeof(PackedVertex);
+
+        for(auto& meshlets : model.meshlets)
+            size += meshlets.size() * sizeof(Meshlet);
+
+        return size;
+    }
+
+    size_t GetMemorySize(const Texture& texture)
+    {
+        size_t size = 0;
+
+        for(int i = 0; i < texture.mipmapCount(); ++i)
+            size += (size_t)texture.mipmap(i).width * texture.mipmap(i).height * sizeof(Color32);
+
+        return size;
+    }
+
+    size_t GetFileSize(const string& filename)
+    {
+        ifstream fin(filename, ios::in | ios::binary | ios::ate);
+        return fin ? (size_t)fin.tellg() : 0;
+    }
+}
+
+WorldStreamer::WorldStreamer(const shared_ptr<Scene>& scene, JobSystem& jobSystem, const shared_ptr<AssetPack>& assetPack)
+    : _scene(scene), _assetPack(assetPack), _loader(jobSystem, assetPack), _modelMemory(0), _textureMemory(0), _loadsInFlight(0), _updateNumber(0)
+{
+}
+
+WorldStreamer::~WorldStreamer()
+{
+    Clear();
+}
+
+void WorldStreamer::AddObject(const ObjectDesc& desc)
+{
+    int x = (int)floor(desc.position.x / cellSize);
+    int z = (int)floor(desc.position.z / cellSize);
+
+    Cell& cell = _cells[GetCellKey(x, z)];
+
+    if(cell.objects.empty())
+    {
+        cell.x = x;
+        cell.z = z;
+        _byDistance.push_back(&cell);
+    }
+
+    cell.objects.push_back(desc);
+}
+
+void WorldStreamer::Update(const Vec3& cameraPosition, const Vec3& cameraVelocity)
+{
+    ++_updateNumber;
+
+    _loader.Update();
+    FinishLoads();
+
+    // cells are ranked by how close they are now, or will be soon if the camera keeps going
+    Vec3 ahead = cameraPosition + cameraVelocity * lookAhead;
+
+    for(Cell* cell : _byDistance)
+        cell->distance = min(GetDistance(*cell, cameraPosition), GetDistance(*cell, ahead));
+
+    sort(_byDistance.begin(), _byDistance.end(), [](const Cell* a, const Cell* b) {
+        return a->distance < b->distance;
+    });
+
+    // the nearest cells in range are kept for as long as they fit in the budgets.
+    // assets that haven't loaded yet count with the size they're estimated to have.
+    size_t models = 0;
+    size_t textures = 0;
+
+    for(Cell* cell : _byDistance)
+    {
+        float range = cell->wanted ? unloadDistance : loadDistance;
+
+        if(cell->distance <= range && Admit(*cell, models, textures))
+            Want(*cell);
+        else if(cell->wanted)
+            Release(*cell);
+    }
+
+    for(Cell* cell : _byDistance)
+    {
+        if(cell->wanted && !cell->inScene && IsReady(*cell))
+            Insert(*cell);
+    }
+
+    ApplySceneChanges();
+    StartLoads();
+    Evict();
+    ReleaseRetired();
+}
+
+void WorldStreamer::Clear()
+{
+    for(Cell* cell : _byDistance)
+    {
+        if(cell->wanted)
+            Release(*cell);
+    }
+
+    ApplySceneChanges();
+
+    // loads still running finish into the loader, and are dropped
+    _models.clear();
+    _textures.clear();
+    _modelMemory = 0;
+    _textureMemory = 0;
+    _loadsInFlight = 0;
+}
+
+size_t WorldStreamer::cellCount() const {
+    return _cells.size();
+}
+
+size_t WorldStreamer::loadedCellCount() const
+{
+    size_t count = 0;
+
+    for(auto& it : _cells)
+    {
+        if(it.second.inScene)
+            ++count;
+    }
+
+    return count;
+}
+
+size_t WorldStreamer::modelMemory() const {
+    return _modelMemory;
+}
+
+size_t WorldStreamer::textureMemory() const {
+    return _textureMemory;
+}
+
+float WorldStreamer::GetDistance(const Cell& cell, const Vec3& point) const
+{
+    // to the nearest point of the cell's square
+    float x0 = cell.x * cellSize;
+    float z0 = cell.z * cellSize;
+    float dx = max(max(x0 - point.x, point.x - (x0 + cellSize)), 0.0f);
+    float dz = max(max(z0 - point.z, point.z - (z0 + cellSize)), 0.0f);
+    return sqrt(dx * dx + dz * dz);
+}
+
+size_t WorldStreamer::EstimateModelSize(const string& filename) const
+{
+    // exact for packed models, a rough guess from the file otherwise
+    size_t size = _assetPack ? _assetPack->GetModelSize(filename) : 0;
+    return size ? size : GetFileSize(filename);
+}
+
+size_t WorldStreamer::EstimateTextureSize(const string& filename) const
+{
+    // files are about the size of the first mipmap, and the rest add a third
+    size_t size = _assetPack ? _assetPack->GetTextureSize(filename) : 0;
+    return size ? size : GetFileSize(filename) * 4 / 3;
+}
+
+bool WorldStreamer::Admit(Cell& cell, size_t& models, size_t& textures)
+{
+    // assets shared with nearer cells, or with other objects of the cell, only count once
+    size_t cellModels = 0;
+    size_t cellTextures = 0;
+    _counted.clear();
+
+    for(auto& desc : cell.objects)
+    {
+        auto& model = _models[desc.model];
+        if(!model.sized)
+        {
+            model.size = EstimateModelSize(desc.model);
+            model.sized = true;
+        }
+
+        if(model.counted != _updateNumber)
+        {
+            model.counted = _updateNumber;
+            cellModels += model.size;
+            _counted.push_back(&model.counted);
+        }
+
+        auto& texture = _textures[desc.texture];
+        if(!texture.sized)
+        {
+            texture.size = EstimateTextureSize(desc.texture);
+            texture.sized = true;
+        }
+
+        if(texture.counted != _updateNumber)
+        {
+            texture.counted = _updateNumber;
+            cellTextures += texture.size;
+            _counted.push_back(&texture.counted);
+        }
+    }
+
+    if(models + cellModels > modelBudget || textures + cellTextures > textureBudget)
+    {
+        // a further cell may use them and still fit
+        for(uint64_t* counted : _counted)
+            *counted = 0;
+
+        return false;
+    }
+
+    models += cellModels;
+    textures += cellTextures;
+    return true;
+}
+
+void WorldStreamer::Want(Cell& cell)
+{
+    if(cell.wanted)
+        return;
+
+    cell.wanted = true;
+
+    for(auto& desc : cell.objects)
+    {
+        ++_models[desc.model].users;
+        ++_textures[desc.texture].users;
+    }
+}
+
+void WorldStreamer::Release(Cell& cell)
+{
+    if(cell.inScene)
+        Remove(cell);
+
+    cell.wanted = false;
+
+    for(auto& desc : cell.objects)
+    {
+        auto& model = _models[desc.model];
+        --model.users;
+        model.lastUsed = _updateNumber;
+
+        auto& texture = _textures[desc.texture];
+        --texture.users;
+        texture.lastUsed = _updateNumber;
+    }
+}
+
+void WorldStreamer::Insert(Cell& cell)
+{
+    for(auto& desc : cell.objects)
+    {
+        auto obj = AlignedMakeShared<SceneObject, 16>(desc.name, _models[desc.model].asset,
+                                                      _textures[desc.texture].asset, desc.shader, desc.cullMode);
+        obj->castShadows = desc.castShadows;
+        obj->transform.SetPosition(desc.position);
+        obj->transform.SetRotation(desc.rotation.x, desc.rotation.y, desc.rotation.z);
+        obj->transform.SetScale(desc.scale);
+
+        cell.sceneObjects.push_back(obj);
+        _added.push_back(obj);
+    }
+
+    cell.inScene = true;
+}
+
+void WorldStreamer::Remove(Cell& cell)
+{
+    // the frames drawn up to now may still be using them
+    uint64_t lastDrawn = _scene->context ? _scene->context->frameNumber() : 0;
+
+    for(auto& obj : cell.sceneObjects)
+    {
+        _removed.push_back(obj.get());
+        _retired.emplace_back(lastDrawn, move(obj));
+    }
+
+    cell.sceneObjects.clear();
+    cell.inScene = false;
+}
+
+void WorldStreamer::ApplySceneChanges()
+{
+    auto& objects = _scene->objects;
+
+    if(!_removed.empty())
+    {
+        sort(_removed.begin(), _removed.end());
+
+        objects.erase(remove_if(objects.begin(), objects.end(), [this](const shared_ptr<SceneObject>& obj) {
+            return binary_search(_removed.begin(), _removed.end(), obj.get());
+        }), objects.end());
+
+        _removed.clear();
+    }
+
+    objects.insert(objects.end(), _added.begin(), _added.end());
+    _added.clear();
+}
+
+bool WorldStreamer::IsReady(const Cell& cell) const
+{
+    for(auto& desc : cell.objects)
+    {
+        if(!_models.at(desc.model).asset || !_textures.at(desc.texture).asset)
+            return false;
+    }
+
+    return true;
+}
+
+void WorldStreamer::StartLoads()
+{
+    _loader.packModels = packModels;
+
+    // nearest cells first
+    for(Cell* cell : _byDistance)
+    {
+        if(_loadsInFlight >= maxLoadsInFlight)
+            return;
+
+        if(!cell->wanted || cell->inScene)
+            continue;
+
+        for(auto& desc : cell->objects)
+        {
+            auto& model = _models[desc.model];
+            if(!model.asset && !model.loading && _loadsInFlight < maxLoadsInFlight)
+            {
+                model.loading = _loader.LoadModel(desc.model);
+                ++_loadsInFlight;
+            }
+
+            auto& texture = _textures[desc.texture];
+            if(!texture.asset && !texture.loading && _loadsInFlight < maxLoadsInFlight)
+            {
+                texture.loading = _loader.LoadTexture(desc.texture, filterMode);
+                ++_loadsInFlight;
+            }
+        }
+    }
+}
+
+void WorldStreamer::FinishLoads()
+{
+    // assets that failed to load are replaced by placeholders, so that the rest of their cell still shows up
+    for(auto& it : _models)
+    {
+        auto& model = it.second;
+        if(model.loading && model.loading->ready())
+        {
+            model.asset = model.loading->asset();
+            if(!model.asset)
+                model.asset = AssetLoader::PlaceholderModel();
+
+            model.loading.reset();
+            model.size = GetMemorySize(*model.asset);
+            model.lastUsed = _updateNumber;
+            _modelMemory += model.size;
+            --_loadsInFlight;
+        }
+    }
+
+    for(auto& it : _textures)
+    {
+        auto& texture = it.second;
+        if(texture.loading && texture.loading->ready())
+        {
+            texture.asset = texture.loading->asset();
+            if(!texture.asset)
+                texture.asset = AssetLoader::PlaceholderTexture();
+
+            texture.loading.reset();
+            texture.size = GetMemorySize(*texture.asset);
+            texture.lastUsed = _updateNumber;
+            _textureMemory += texture.size;
+            --_loadsInFlight;
+        }
+    }
+}
+
+void WorldStreamer::Evict()
+{
+    // the least recently used assets that no cell wants go first
+    auto evict = [this](auto& assets, size_t& memory, size_t budget)
+    {
+        while(memory > budget)
+        {
+            auto lru = assets.end();
+
+            for(auto it = assets.begin(); it != assets.end(); ++it)
+            {
+                if(it->second.asset && it->second.users == 0
+                && (lru == assets.end() || it->second.lastUsed < lru->second.lastUsed))
+                    lru = it;
+            }
+
+            if(lru == assets.end())
+                return;
+
+            memory -= lru->second.size;
+            lru->second.asset.reset();
+        }
+    };
+
+    evict(_models, _modelMemory, modelBudget);
+    evict(_textures, _textureMemory, textureBudget);
+}
+
+void WorldStreamer::ReleaseRetired()
+{
+    // without a context drawing the scene, no frames are in flight
+    uint64_t finished = _scene->context ? _scene->context->finishedFrameNumber() : UINT64_MAX;
+
+    auto last = remove_if(_retired.begin(), _retired.end(), [finished](const pair<uint64_t, shared_ptr<SceneObject>>& retired) {
+        return retired.first <= finished;
+    });
+
+    _retired.erase(last, _retired.end());
+}
@@ -0,0 +1,155 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AssetLoader.h"
+#include "Math.h"
+#include "SceneObject.h"
+using namespace std;
+
+class AssetPack;
+class Scene;
+
+// Streams a world too large to keep in memory into a scene, around the camera.
+//
+// The world is split into square cells on the XZ plane, each with the objects whose position
+// falls in it, and each object names the model and texture it needs. Every update, the cells
+// near the camera, or near where it'll be 'lookAhead' seconds from now, are loaded nearest first
+// for as long as what they use fits in the budgets. Their assets load in the background, and once
+// all of a cell's assets are in, its objects are added to the scene. Cells the camera has moved
+// away from are taken out of the scene again.
+//
+// Assets are shared by the cells that use them, and kept once no cell does, until the memory
+// they take goes over budget. The least recently used ones are freed first.
+//
+// Everything runs on the thread that calls Update(), which should be the one calling Draw(),
+// between frames. The cells' objects are added to and taken out of the scene all at once at the
+// end of the update. The ones taken out are kept alive until the frames that may still be drawing
+// them have finished.
+class WorldStreamer
+{
+public:
+    struct ObjectDesc
+    {
+        string name;
+        string model;   // filenames, see AssetLoader
+        string texture;
+        shared_ptr<Shader> shader;
+        CullMode cullMode = CullMode::Back;
+        bool castShadows = true;
+        Vec3 position = Vec3::zero;
+        Vec3 rotation = Vec3::zero; // euler angles, in degrees
+        Vec3 scale = Vec3(1, 1, 1);
+    };
+
+    // cells are loaded once they're within 'loadDistance' of the camera, and unloaded
+    // once they're further than 'unloadDistance', so that they don't flicker in and out
+    float cellSize = 64.0f;
+    float loadDistance = 128.0f;
+    float unloadDistance = 160.0f;
+    float lookAhead = 1.0f; // seconds
+
+    // bytes of model and texture memory. cells beyond the nearest ones that fit aren't loaded.
+    size_t modelBudget = 256 * 1024 * 1024;
+    size_t textureBudget = 512 * 1024 * 1024;
+
+    // assets loading at once. the nearest cells' are started first, and further
+    // ones wait, so that what's about to be seen isn't stuck behind them.
+    int maxLoadsInFlight = 4;
+
+    FilterMode filterMode = FilterMode::Bilinear;
+
+    // models are packed as they load, see Model::Pack()
+    bool packModels = false;
+
+    WorldStreamer(const shared_ptr<Scene>& scene, JobSystem& jobSystem, const shared_ptr<AssetPack>& assetPack = nullptr);
+    ~WorldStreamer();
+
+    WorldStreamer(const WorldStreamer&) = delete;
+    WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+    // adds an object to the cell its position is in. cells are loaded on the next update.
+    void AddObject(const ObjectDesc& desc);
+
+    // once per frame, before drawing it
+    void Update(const Vec3& cameraPosition, const Vec3& cameraVelocity);
+
+    // takes all of the world's objects out of the scene and frees their assets.
+    // the objects are only kept alive for the frames in flight until the streamer is destroyed,
+    // so the rendering context has to be flushed before that.
+    void Clear();
+
+    size_t cellCount() const;
+    size_t loadedCellCount() const;
+    size_t modelMemory() const;
+    size_t textureMemory() const;
+
+private:
+    template<class T>
+    struct Asset
+    {
+        shared_ptr<T> asset;
+        shared_ptr<AssetHandle<T>> loading;
+        size_t size = 0;        // in bytes. estimated until it has loaded, and kept after it's freed, for the budgets
+        bool sized = false;
+
+        int users = 0;          // cells that want it
+        uint64_t lastUsed = 0;  // update number
+        uint64_t counted = 0;   // update the budgets last counted it in
+    };
+
+    struct Cell
+    {
+        int x, z;
+        vector<ObjectDesc> objects;
+        vector<shared_ptr<SceneObject>> sceneObjects; // while in the scene
+        bool wanted = false;  // holds on to its assets
+        bool inScene = false;
+        float distance = 0;
+    };
+
+    float GetDistance(const Cell& cell, const Vec3& point) const;
+    size_t EstimateModelSize(const string& filename) const;
+    size_t EstimateTextureSize(const string& filename) const;
+    bool Admit(Cell& cell, size_t& models, size_t& textures);
+    void Want(Cell& cell);
+    void Release(Cell& cell);
+    void Insert(Cell& cell);
+    void Remove(Cell& cell);
+    void ApplySceneChanges();
+    bool IsReady(const Cell& cell) const;
+    void StartLoads();
+    void FinishLoads();
+    void Evict();
+    void ReleaseRetired();
+
+    shared_ptr<Scene> _scene;
+    shared_ptr<AssetPack> _assetPack;
+    AssetLoader _loader;
+
+    unordered_map<uint64_t, Cell> _cells;
+    vector<Cell*> _byDistance;
+    unordered_map<string, Asset<Model>> _models;
+    unordered_map<string, Asset<Texture>> _textures;
+    size_t _modelMemory;
+    size_t _textureMemory;
+    int _loadsInFlight;
+    uint64_t _updateNumber;
+
+    // changes to the scene's objects, made together at the end of the update,
+    // so that the scene's bvh is rebuilt at most once for all of them
+    vector<shared_ptr<SceneObject>> _added;
+    vector<const SceneObject*> _removed;
+
+    // objects taken out of the scene, and the number of the last frame drawn with them
+    vector<pair<uint64_t, shared_ptr<SceneObject>>> _retired;
+
+    vector<uint64_t*> _counted; // by Admit()
+};
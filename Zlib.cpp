@@ -0,0 +1,458 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#include "Zlib.h"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    // reads bits least significant first, refilling a 64 bit buffer a byte at a time.
+    // reading past the end gives zeros, which overrun() tells apart from real data.
+    class BitReader
+    {
+    public:
+        BitReader(const uint8_t* data, size_t size)
+            : _next(data), _end(data + size), _bits(0), _count(0), _padding(0) {}
+
+        // makes sure at least 57 bits are buffered
+        void Refill()
+        {
+            while(_count <= 56)
+            {
+                uint64_t byte = 0;
+
+                if(_next < _end)
+                    byte = *_next++;
+                else
+                    ++_padding;
+
+                _bits |= byte << _count;
+                _count += 8;
+            }
+        }
+
+        uint32_t Peek(int n) const {
+            return (uint32_t)(_bits & ((1ull << n) - 1));
+        }
+
+        void Consume(int n) {
+            _bits >>= n;
+            _count -= n;
+        }
+
+        uint32_t Read(int n)
+        {
+            Refill();
+            uint32_t value = Peek(n);
+            Consume(n);
+            return value;
+        }
+
+        void AlignToByte() {
+            Consume(_count & 7);
+        }
+
+        // after AlignToByte()
+        bool ReadBytes(uint8_t* dst, size_t size)
+        {
+            // whatever is still buffered goes first
+            while(size > 0 && _count > 0)
+            {
+                *dst++ = (uint8_t)Peek(8);
+                Consume(8);
+                --size;
+            }
+
+            if(size > (size_t)(_end - _next))
+                return false;
+
+            if(size > 0)
+                memcpy(dst, _next, size);
+
+            _next += size;
+            return true;
+        }
+
+        // true if more bits were read than there are
+        bool overrun() const {
+            return _padding * 8 > (size_t)_count;
+        }
+
+    private:
+        const uint8_t* _next;
+        const uint8_t* _end;
+        uint64_t _bits;
+        int _count;
+        size_t _padding;
+    };
+
+    // canonical Huffman code. codes up to FastBits long are decoded with a single lookup,
+    // longer ones a bit at a time.
+    class Huffman
+    {
+    public:
+        static constexpr int FastBits = 10;
+        static constexpr int MaxBits = 15;
+
+        // 'lengths' are the code lengths of the symbols, 0 for unused ones.
+        // returns false if there are more codes than the lengths allow.
+        bool Build(const uint8_t* lengths, int count)
+        {
+            memset(_counts, 0, sizeof(_counts));
+
+            for(int s = 0; s < count; ++s)
+                ++_counts[lengths[s]];
+
+            _counts[0] = 0;
+
+            int left = 1;
+            for(int len = 1; len <= MaxBits; ++len)
+            {
+                left = (left << 1) - _counts[len];
+                if(left < 0)
+                    return false;
+            }
+
+            uint16_t offsets[MaxBits + 1] = {};
+            for(int len = 1; len < MaxBits; ++len)
+                offsets[len + 1] = offsets[len] + _counts[len];
+
+            for(int s = 0; s < count; ++s)
+            {
+                if(lengths[s] != 0)
+                    _symbols[offsets[lengths[s]]++] = (uint16_t)s;
+            }
+
+            // the codes are read starting from their most significant bit,
+            // so they're reversed to index the table with the bits as they come
+            memset(_fast, 0, sizeof(_fast));
+
+            uint32_t code = 0;
+            int index = 0;
+
+            for(int len = 1; len <= FastBits; ++len)
+            {
+                for(int i = 0; i < _counts[len]; ++i, ++code)
+                {
+                    uint32_t reversed = 0;
+                    for(int b = 0; b < len; ++b)
+                        reversed |= ((code >> b) & 1) << (len - 1 - b);
+
+                    uint16_t entry = (uint16_t)(len << 12 | _symbols[index++]);
+
+                    for(uint32_t r = reversed; r < (1u << FastBits); r += 1u << len)
+                        _fast[r] = entry;
+                }
+
+                code <<= 1;
+            }
+
+            return true;
+        }
+
+        // returns -1 for a code that isn't in the table
+        int Decode(BitReader& reader) const
+        {
+            reader.Refill();
+
+            uint16_t entry = _fast[reader.Peek(FastBits)];
+            if(entry != 0)
+            {
+                reader.Consume(entry >> 12);
+                return entry & 0xFFF;
+            }
+
+            uint32_t bits = reader.Peek(MaxBits);
+            int code = 0;
+            int first = 0;
+            int index = 0;
+
+            for(int len = 1; len <= MaxBits; ++len)
+            {
+                code |= (bits >> (len - 1)) & 1;
+
+                int count = _counts[len];
+                if(code - count < first)
+                {
+                    reader.Consume(len);
+                    return _symbols[index + (code - first)];
+                }
+
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+
+            return -1;
+        }
+
+    private:
+        uint16_t _fast[1 << FastBits]; // length << 12 | symbol, 0 for longer codes
+        uint16_t _counts[MaxBits + 1];
+        uint16_t _symbols[288];        // sorted by code
+    };
+
+    const uint16_t LengthBase[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+
+    const uint8_t LengthExtra[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+    };
+
+    const uint16_t DistanceBase[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+    };
+
+    const uint8_t DistanceExtra[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+    };
+
+    bool InflateBlock(BitReader& reader, const Huffman& lengths, const Huffman& distances,
+                      uint8_t* dst, size_t dstSize, size_t& pos)
+    {
+        for(;;)
+        {
+            int symbol = lengths.Decode(reader);
+
+            if(symbol < 0)
+                return false;
+
+            if(symbol < 256)
+            {
+                if(pos == dstSize)
+                    return false;
+
+                dst[pos++] = (uint8_t)symbol;
+            }
+            else if(symbol == 256)
+            {
+                return true;
+            }
+            else
+            {
+                symbol -= 257;
+                if(symbol >= 29)
+                    return false;
+
+                size_t length = LengthBase[symbol] + reader.Read(LengthExtra[symbol]);
+
+                int d = distances.Decode(reader);
+                if(d < 0 || d >= 30)
+                    return false;
+
+                size_t distance = DistanceBase[d] + reader.Read(DistanceExtra[d]);
+
+                if(distance > pos || length > dstSize - pos)
+                    return false;
+
+                // the copy can overlap what it writes, repeating the last 'distance' bytes
+                const uint8_t* from = dst + pos - distance;
+                uint8_t* to = dst + pos;
+
+                for(size_t i = 0; i < length; ++i)
+                    to[i] = from[i];
+
+                pos += length;
+            }
+        }
+    }
+
+    bool ReadDynamicCodes(BitReader& reader, Huffman& lengths, Huffman& distances)
+    {
+        static const uint8_t Order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+        int lengthCount = reader.Read(5) + 257;
+        int distanceCount = reader.Read(5) + 1;
+        int codeLengthCount = reader.Read(4) + 4;
+
+        if(lengthCount > 286 || distanceCount > 30)
+            return false;
+
+        uint8_t codeLengths[19] = {};
+        for(int i = 0; i < codeLengthCount; ++i)
+            codeLengths[Order[i]] = (uint8_t)reader.Read(3);
+
+        Huffman codeLengthCode;
+        if(!codeLengthCode.Build(codeLengths, 19))
+            return false;
+
+        // the code lengths of both codes are sent as one sequence
+        uint8_t codeBits[286 + 30];
+        int total = lengthCount + distanceCount;
+        int n = 0;
+
+        while(n < total)
+        {
+            int symbol = codeLengthCode.Decode(reader);
+
+            if(symbol < 0)
+                return false;
+
+            if(symbol < 16)
+            {
+                codeBits[n++] = (uint8_t)symbol;
+                continue;
+            }
+
+            uint8_t value = 0;
+            int repeat;
+
+            if(symbol == 16)
+            {
+                if(n == 0)
+                    return false;
+
+                value = codeBits[n - 1];
+                repeat = 3 + reader.Read(2);
+            }
+            else if(symbol == 17)
+            {
+                repeat = 3 + reader.Read(3);
+            }
+            else
+            {
+                repeat = 11 + reader.Read(7);
+            }
+
+            if(n + repeat > total)
+                return false;
+
+            while(repeat-- > 0)
+                codeBits[n++] = value;
+        }
+
+        // without an end of block code the block can't end
+        if(codeBits[256] == 0)
+            return false;
+
+        return lengths.Build(codeBits, lengthCount)
+            && distances.Build(codeBits + lengthCount, distanceCount);
+    }
+
+    struct FixedCodes
+    {
+        Huffman lengths;
+        Huffman distances;
+
+        FixedCodes()
+        {
+            uint8_t bits[288];
+            fill(bits, bits + 144, 8);
+            fill(bits + 144, bits + 256, 9);
+            fill(bits + 256, bits + 280, 7);
+            fill(bits + 280, bits + 288, 8);
+            lengths.Build(bits, 288);
+
+            fill(bits, bits + 30, 5);
+            distances.Build(bits, 30);
+        }
+    };
+}
+
+bool Zlib::Inflate(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+{
+    // 2 byte header, at least one block and a 4 byte checksum
+    if(srcSize < 7)
+        return false;
+
+    // deflate with a window of at most 32K, and no preset dictionary
+    uint32_t cmf = src[0];
+    uint32_t flg = src[1];
+
+    if((cmf & 0x0F) != 8 || (cmf >> 4) > 7 || (cmf << 8 | flg) % 31 != 0 || (flg & 0x20) != 0)
+        return false;
+
+    static const FixedCodes fixedCodes;
+
+    BitReader reader(src + 2, srcSize - 2);
+    size_t pos = 0;
+    bool last = false;
+
+    while(!last)
+    {
+        last = reader.Read(1) != 0;
+        uint32_t type = reader.Read(2);
+
+        if(type == 0)
+        {
+            reader.AlignToByte();
+
+            uint32_t length = reader.Read(16);
+            uint32_t complement = reader.Read(16);
+
+            if(length != (~complement & 0xFFFF) || length > dstSize - pos)
+                return false;
+
+            if(!reader.ReadBytes(dst + pos, length))
+                return false;
+
+            pos += length;
+        }
+        else if(type == 1)
+        {
+            if(!InflateBlock(reader, fixedCodes.lengths, fixedCodes.distances, dst, dstSize, pos))
+                return false;
+        }
+        else if(type == 2)
+        {
+            Huffman lengths, distances;
+
+            if(!ReadDynamicCodes(reader, lengths, distances)
+            || !InflateBlock(reader, lengths, distances, dst, dstSize, pos))
+                return false;
+        }
+        else
+        {
+            return false;
+        }
+
+        if(reader.overrun())
+            return false;
+    }
+
+    if(pos != dstSize)
+        return false;
+
+    // big endian adler-32 of the uncompressed data, starting at the next byte
+    reader.AlignToByte();
+
+    uint32_t checksum = 0;
+    for(int i = 0; i < 4; ++i)
+        checksum = checksum << 8 | reader.Read(8);
+
+    return !reader.overrun() && checksum == Adler32(dst, dstSize);
+}
+
+uint32_t Zlib::Adler32(const uint8_t* data, size_t size)
+{
+    const uint32_t Modulus = 65521;
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+
+    while(size > 0)
+    {
+        // the most bytes that can be summed before 'b' could overflow
+        size_t n = min(size, (size_t)5552);
+        size -= n;
+
+        while(n-- > 0)
+        {
+            a += *data++;
+            b += a;
+        }
+
+        a %= Modulus;
+        b %= Modulus;
+    }
+
+    return b << 16 | a;
+}
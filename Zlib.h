@@ -0,0 +1,21 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+using namespace std;
+
+// Decompresses zlib streams (RFC 1950 around RFC 1951 deflate), as found in the arrays of
+// binary FBX files. Only decompression is supported.
+class Zlib
+{
+public:
+    // inflates 'src' into 'dst', which has to be exactly the size of the uncompressed data.
+    // returns false if the stream is damaged, doesn't fill 'dst' or doesn't fit in it.
+    static bool Inflate(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+    static uint32_t Adler32(const uint8_t* data, size_t size);
+};
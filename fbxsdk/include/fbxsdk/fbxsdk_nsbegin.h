@@ -1,17 +0,0 @@
-/****************************************************************************************
- 
-   Copyright (C) 2015 Autodesk, Inc.
-   All rights reserved.
- 
-   Use of this software is subject to the terms of the Autodesk license agreement
-   provided at the time of installation or download, or which otherwise accompanies
-   this software in either electronic or hard copy form.
- 
-****************************************************************************************/
-
-//! \file fbxsdk_nsbegin.h
-#include <fbxsdk/fbxsdk_version.h>
-
-#if FBXSDK_DEFINE_NAMESPACE == 1
-	namespace FBXSDK_NAMESPACE {
-#endif
@@ -0,0 +1,156 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+// Draws a lit, shadowed scene headless with frames in flight while the camera orbits it and one
+// of the boxes moves, and checks that once every frame of the loop has been drawn, drawing it
+// again doesn't allocate anything. With COUNT_ALLOCATIONS, that counts every heap allocation.
+
+#include "Camera.h"
+#include "CustomShaders.h"
+#include "InstancedObject.h"
+#include "JobSystem.h"
+#include "Light.h"
+#include "Mem.h"
+#include "Model.h"
+#include "RenderingContext.h"
+#include "Scene.h"
+#include "SceneObject.h"
+#include "Texture.h"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+using namespace std;
+
+namespace
+{
+    const uint32_t Width = 160;
+    const uint32_t Height = 120;
+
+    // the camera and the moving box both come back to where they started after this many frames
+    const int LoopFrames = 126;
+
+    void AddQuad(Model& model, const Vec3& origin, const Vec3& u, const Vec3& v, const Vec3& normal)
+    {
+        const Vec3 corners[4] = { origin, origin + u, origin + u + v, origin + v };
+        const Vec2 texcoords[4] = { Vec2(0, 0), Vec2(1, 0), Vec2(1, 1), Vec2(0, 1) };
+        const int indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+        for(int i : indices)
+            model.vertices.push_back(Vertex(corners[i], normal, texcoords[i], texcoords[i], corners[i]));
+    }
+
+    shared_ptr<Model> MakeBox()
+    {
+        auto model = AlignedMakeShared<Model, 16>();
+
+        AddQuad(*model, Vec3(-0.5f, -0.5f, -0.5f), Vec3(1, 0, 0), Vec3(0, 1, 0), Vec3(0, 0, -1));
+        AddQuad(*model, Vec3(0.5f, -0.5f, 0.5f), Vec3(-1, 0, 0), Vec3(0, 1, 0), Vec3(0, 0, 1));
+        AddQuad(*model, Vec3(-0.5f, -0.5f, 0.5f), Vec3(0, 0, -1), Vec3(0, 1, 0), Vec3(-1, 0, 0));
+        AddQuad(*model, Vec3(0.5f, -0.5f, -0.5f), Vec3(0, 0, 1), Vec3(0, 1, 0), Vec3(1, 0, 0));
+        AddQuad(*model, Vec3(-0.5f, 0.5f, -0.5f), Vec3(1, 0, 0), Vec3(0, 0, 1), Vec3(0, 1, 0));
+        AddQuad(*model, Vec3(-0.5f, -0.5f, 0.5f), Vec3(1, 0, 0), Vec3(0, 0, -1), Vec3(0, -1, 0));
+
+        model->RecalcBounds();
+        return model;
+    }
+
+    shared_ptr<Model> MakeGround()
+    {
+        auto model = AlignedMakeShared<Model, 16>();
+
+        for(int x = -4; x < 4; ++x)
+        {
+            for(int z = -4; z < 4; ++z)
+                AddQuad(*model, Vec3(x * 2.0f, 0, z * 2.0f), Vec3(0, 0, 2), Vec3(2, 0, 0), Vec3(0, 1, 0));
+        }
+
+        model->RecalcBounds();
+        return model;
+    }
+}
+
+int main()
+{
+    auto jobSystem = make_shared<JobSystem>(4);
+    auto context = AlignedMakeShared<RenderingContext, 16>(Width, Height, jobSystem);
+    context->maxFramesInFlight(2);
+
+    auto scene = AlignedMakeShared<Scene, 16>();
+    scene->camera = AlignedMakeShared<Camera, 16>(60.0f, (float)Width / Height, 0.1f, 100.0f);
+
+    Color32 pixels[16];
+    for(auto& pixel : pixels)
+        pixel = Color32(200, 180, 160, 255);
+
+    auto texture = AlignedMakeShared<Texture, 16>(pixels, 4, 4, FilterMode::Bilinear);
+    auto shader = AlignedMakeShared<LitShader, 16>();
+    auto box = MakeBox();
+
+    scene->objects.push_back(AlignedMakeShared<SceneObject, 16>("ground", MakeGround(), texture, shader, CullMode::Back));
+
+    vector<shared_ptr<SceneObject>> boxes;
+    for(int i = 0; i < 6; ++i)
+    {
+        auto object = AlignedMakeShared<SceneObject, 16>("box", box, texture, shader, CullMode::Back);
+        object->transform.SetPosition(Vec3(i * 1.5f - 4.0f, 0.5f, 1.0f));
+        scene->objects.push_back(object);
+        boxes.push_back(object);
+    }
+
+    auto instances = AlignedMakeShared<InstancedObject, 16>("boxes", box, texture, shader, CullMode::Back);
+    for(int i = 0; i < 20; ++i)
+        instances->AddInstance(Vec3((i % 5) * 1.2f - 3.0f, 0.25f, (i / 5) * 1.2f - 4.0f), Quat::identity, Vec3(0.5f, 0.5f, 0.5f));
+    scene->instancedObjects.push_back(instances);
+
+    auto sun = AlignedMakeShared<DirectionalLight, 16>("sun", Color::white, 1.0f, Vec3(0.3f, -1.0f, 0.4f).Normalized());
+    sun->castShadows = true;
+
+    scene->lights.push_back(AlignedMakeShared<AmbientLight, 16>("ambient", Color(0.2f, 0.2f, 0.2f, 1.0f), 1.0f));
+    scene->lights.push_back(sun);
+    scene->lights.push_back(AlignedMakeShared<PointLight, 16>("point", Color(1.0f, 0.5f, 0.2f, 1.0f), 2.0f, Vec3(0, 2, 0), 1.0f, 6.0f));
+
+    auto drawFrame = [&](int frame)
+    {
+        float angle = frame * Math::TwoPi / LoopFrames;
+        scene->camera->transform.SetPosition(Vec3(sinf(angle) * 10.0f, 5.0f, cosf(angle) * -10.0f));
+        scene->camera->transform.SetRotation(25.0f, -angle * Math::RadToDeg, 0.0f);
+        boxes[0]->transform.SetPosition(Vec3(sinf(angle * 3.0f) * 3.0f, 0.5f, -2.0f));
+
+        context->Clear(true, true);
+        context->Draw(scene);
+        context->Present();
+    };
+
+    // the first time around, the arenas and pools grow to what the frames need
+    for(int frame = 0; frame < LoopFrames; ++frame)
+        drawFrame(frame);
+
+    context->Flush();
+
+    uint64_t before = AllocationCount();
+
+    for(int frame = 0; frame < LoopFrames * 2; ++frame)
+        drawFrame(frame);
+
+    context->Flush();
+
+    uint64_t allocations = AllocationCount() - before;
+
+#if COUNT_ALLOCATIONS
+    const char* counted = "heap allocations";
+#else
+    const char* counted = "AlignedAlloc() calls";
+#endif
+
+    printf("%s over %d frames: %llu\n", counted, LoopFrames * 2, (unsigned long long)allocations);
+
+    if(allocations != 0)
+    {
+        printf("FAILED: steady state frames don't allocate\n");
+        return 1;
+    }
+
+    return 0;
+}
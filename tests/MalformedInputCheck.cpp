@@ -0,0 +1,199 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+// Feeds truncated and corrupted data to Zlib and FbxFile. Zlib has to return false, or the
+// original data if the damage missed everything it reads. FbxFile has to load or throw a
+// runtime_error. Neither may crash, read past the data or throw anything else.
+//
+// usage: MalformedInputCheck file.fbx
+
+#include "FbxFile.h"
+#include "Zlib.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+namespace
+{
+    const char Text[] = "to be or not to be, that is the question. to be or not to be.";
+
+    // Text, deflated with fixed huffman codes and back references
+    const uint8_t Deflated[] = {
+        0x78, 0xda, 0x2b, 0xc9, 0x57, 0x48, 0x4a, 0x55, 0xc8, 0x2f, 0x52, 0xc8, 0xcb, 0x2f, 0x51, 0x28,
+        0x01, 0x71, 0x74, 0x14, 0x4a, 0x32, 0x12, 0x4b, 0x14, 0x32, 0x8b, 0x81, 0x74, 0xaa, 0x42, 0x61,
+        0x69, 0x6a, 0x71, 0x49, 0x66, 0x7e, 0x9e, 0x1e, 0x44, 0x12, 0x45, 0xa5, 0x1e, 0x00, 0x85, 0xc1,
+        0x14, 0xbb
+    };
+
+    const size_t TextSize = sizeof(Text) - 1;
+
+    // Text in a stored block
+    vector<uint8_t> Stored()
+    {
+        vector<uint8_t> stream = { 0x78, 0x01, 0x01, (uint8_t)TextSize, 0, (uint8_t)~TextSize, 0xFF };
+        stream.insert(stream.end(), Text, Text + TextSize);
+
+        uint32_t adler = Zlib::Adler32((const uint8_t*)Text, TextSize);
+        for(int shift = 24; shift >= 0; shift -= 8)
+            stream.push_back((uint8_t)(adler >> shift));
+
+        return stream;
+    }
+
+    bool Inflate(const vector<uint8_t>& src, vector<uint8_t>& dst, size_t dstSize)
+    {
+        dst.assign(dstSize, 0);
+        return Zlib::Inflate(src.data(), src.size(), dst.data(), dst.size());
+    }
+
+    bool IsText(const vector<uint8_t>& data) {
+        return data.size() == TextSize && memcmp(data.data(), Text, TextSize) == 0;
+    }
+
+    enum class LoadResult { Loaded, Rejected, Failed };
+
+    LoadResult Load(const vector<uint8_t>& data, const char* path)
+    {
+        {
+            ofstream fout(path, ios::out | ios::binary | ios::trunc);
+            fout.write((const char*)data.data(), data.size());
+        }
+
+        try {
+            FbxFile fbx(path);
+            return LoadResult::Loaded;
+        }
+        catch(runtime_error&) {
+            return LoadResult::Rejected;
+        }
+        catch(exception& ex) {
+            printf("unexpected exception: %s\n", ex.what());
+            return LoadResult::Failed;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2)
+    {
+        printf("usage: MalformedInputCheck file.fbx\n");
+        return 1;
+    }
+
+    int failures = 0;
+
+    auto check = [&failures](bool passed, const char* what) {
+        if(!passed)
+        {
+            printf("FAILED: %s\n", what);
+            ++failures;
+        }
+    };
+
+    vector<uint8_t> out;
+    const vector<uint8_t> streams[2] = { vector<uint8_t>(Deflated, Deflated + sizeof(Deflated)), Stored() };
+
+    for(auto& stream : streams)
+    {
+        check(Inflate(stream, out, TextSize) && IsText(out), "a zlib stream inflates");
+        check(!Inflate(stream, out, TextSize - 1), "a zlib stream that doesn't fit is rejected");
+        check(!Inflate(stream, out, TextSize + 1), "a zlib stream that comes up short is rejected");
+
+        bool truncated = false;
+        for(size_t size = 0; size < stream.size(); ++size)
+            truncated |= Inflate(vector<uint8_t>(stream.begin(), stream.begin() + size), out, TextSize);
+
+        check(!truncated, "truncated zlib streams are rejected");
+
+        bool flipped = false;
+        for(size_t bit = 0; bit < stream.size() * 8; ++bit)
+        {
+            vector<uint8_t> damaged(stream);
+            damaged[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+            flipped |= Inflate(damaged, out, TextSize) && !IsText(out);
+        }
+
+        check(!flipped, "zlib streams with a bit flipped are rejected");
+    }
+
+    // noise, with and without a valid header in front of it
+    mt19937 random(1234);
+    bool noise = false;
+
+    for(int i = 0; i < 2000; ++i)
+    {
+        vector<uint8_t> stream(1 + random() % 256);
+        for(auto& byte : stream)
+            byte = (uint8_t)random();
+
+        if(i % 2)
+        {
+            stream[0] = 0x78;
+            stream[1 % stream.size()] = 0x9c;
+        }
+
+        noise |= Inflate(stream, out, 1 + random() % 1024);
+    }
+
+    check(!noise, "noise isn't inflated");
+
+    // an FBX file, cut short and with bytes overwritten, including inside its deflated arrays
+    vector<uint8_t> fbx;
+    {
+        ifstream fin(argv[1], ios::in | ios::binary);
+        fbx.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+    }
+
+    const char* path = "MalformedInputCheck.fbx";
+    int rejected = 0;
+    int loads = 0;
+
+    check(!fbx.empty() && Load(fbx, path) == LoadResult::Loaded, "the FBX file loads");
+
+    try {
+        FbxFile missing("MalformedInputCheck.missing.fbx");
+        check(false, "a missing FBX file is rejected");
+    }
+    catch(runtime_error&) {
+    }
+
+    bool failed = false;
+    const size_t cuts = 200;
+
+    for(size_t i = 0; i < cuts && !fbx.empty(); ++i)
+    {
+        size_t size = fbx.size() * i / cuts;
+        LoadResult result = Load(vector<uint8_t>(fbx.begin(), fbx.begin() + size), path);
+
+        failed |= result == LoadResult::Failed;
+        rejected += result == LoadResult::Rejected;
+        ++loads;
+    }
+
+    for(int i = 0; i < 1000 && !fbx.empty(); ++i)
+    {
+        vector<uint8_t> damaged(fbx);
+        for(int j = 0; j < 4; ++j)
+            damaged[random() % damaged.size()] = (uint8_t)random();
+
+        LoadResult result = Load(damaged, path);
+
+        failed |= result == LoadResult::Failed;
+        rejected += result == LoadResult::Rejected;
+        ++loads;
+    }
+
+    remove(path);
+
+    printf("damaged FBX files rejected: %d of %d\n", rejected, loads);
+    check(!failed, "damaged FBX files load or throw runtime_error");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+// Packs vertices and unpacks them again, and checks that nothing moved by more than packing
+// can account for: half a step of the box for positions, the precision of 16 bit octahedral
+// normals, and half float rounding for uvs. The count isn't a multiple of 4, so the vertices
+// left over after the groups of 4 are checked too.
+
+#include "Math.h"
+#include "PackedVertex.h"
+#include "Vertex.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+using namespace std;
+
+namespace
+{
+    // by component, since Vec3::Length() rounds lengths this small down to 0
+    float Difference(const Vec3& a, const Vec3& b) {
+        return max(max(fabs(a.x - b.x), fabs(a.y - b.y)), fabs(a.z - b.z));
+    }
+
+    // how far a half float can be from the value it was rounded from
+    float HalfError(float value) {
+        return max(fabs(value), 1.0f / 16384.0f) / 2048.0f;
+    }
+
+    struct Errors
+    {
+        float position = 0.0f; // in steps of the box
+        float flatAxis = 0.0f; // along the axes the box has no size on
+        float normal = 0.0f;
+        float texcoord = 0.0f; // in half float rounding steps
+        float worldPos = 0.0f;
+    };
+
+    Errors RoundTrip(const vector<Vertex>& vertices, const Box& bounds)
+    {
+        VertexQuantization quantization(bounds);
+
+        vector<PackedVertex> packed;
+        for(auto& v : vertices)
+            packed.push_back(PackedVertex::Pack(v, quantization));
+
+        vector<Vertex> unpacked(vertices.size());
+        PackedVertex::Unpack(packed.data(), packed.size(), quantization, unpacked.data());
+
+        Errors errors;
+
+        for(size_t i = 0; i < vertices.size(); ++i)
+        {
+            const Vertex& a = vertices[i];
+            const Vertex& b = unpacked[i];
+
+            const float position[3][3] = {
+                { a.position.x, b.position.x, quantization.scale.x },
+                { a.position.y, b.position.y, quantization.scale.y },
+                { a.position.z, b.position.z, quantization.scale.z },
+            };
+
+            for(auto& axis : position)
+            {
+                float error = fabs(axis[0] - axis[1]);
+
+                if(axis[2] > 0.0f)
+                    errors.position = max(errors.position, error / axis[2]);
+                else
+                    errors.flatAxis = max(errors.flatAxis, error);
+            }
+
+            errors.normal = max(errors.normal, Difference(a.normal, b.normal));
+
+            const float texcoords[4][2] = {
+                { a.texcoord.x, b.texcoord.x }, { a.texcoord.y, b.texcoord.y },
+                { a.lightmapCoord.x, b.lightmapCoord.x }, { a.lightmapCoord.y, b.lightmapCoord.y },
+            };
+
+            for(auto& uv : texcoords)
+                errors.texcoord = max(errors.texcoord, fabs(uv[0] - uv[1]) / HalfError(uv[0]));
+
+            Vec3 pos(b.position.x, b.position.y, b.position.z);
+            errors.worldPos = max(errors.worldPos, Difference(b.worldPos, pos));
+        }
+
+        return errors;
+    }
+}
+
+int main()
+{
+    mt19937 random(1234);
+    uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    const Box bounds(Vec3(-3.0f, 0.0f, -250.0f), Vec3(5.0f, 2.0f, 250.0f));
+    const Vec3 extent = bounds.vmax - bounds.vmin;
+
+    vector<Vertex> vertices;
+
+    auto addVertex = [&](const Vec3& position, const Vec3& normal, const Vec2& texcoord, const Vec2& lightmapCoord) {
+        vertices.push_back(Vertex(Vec4(position, 0.0f), normal, texcoord, lightmapCoord, position));
+    };
+
+    // the corners of the box and the axes, where the octahedron folds
+    const Vec3 axes[6] = { Vec3(1, 0, 0), Vec3(-1, 0, 0), Vec3(0, 1, 0), Vec3(0, -1, 0), Vec3(0, 0, 1), Vec3(0, 0, -1) };
+    for(int i = 0; i < 6; ++i)
+        addVertex(i % 2 ? bounds.vmax : bounds.vmin, axes[i], Vec2(0, 1), Vec2(1, 0));
+
+    while(vertices.size() < 1003)
+    {
+        Vec3 position(bounds.vmin.x + extent.x * (unit(random) * 0.5f + 0.5f),
+                      bounds.vmin.y + extent.y * (unit(random) * 0.5f + 0.5f),
+                      bounds.vmin.z + extent.z * (unit(random) * 0.5f + 0.5f));
+
+        // normalized exactly, where Normalized() is only as precise as the hardware's estimate
+        Vec3 normal(unit(random), unit(random), unit(random));
+        float length = sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+        if(length < 0.01f)
+            continue;
+
+        // tiled uvs go past 1, lightmap uvs don't
+        Vec2 texcoord(unit(random) * 8.0f, unit(random) * 8.0f);
+        Vec2 lightmapCoord(unit(random) * 0.5f + 0.5f, unit(random) * 0.5f + 0.5f);
+
+        addVertex(position, normal / length, texcoord, lightmapCoord);
+    }
+
+    Errors errors = RoundTrip(vertices, bounds);
+
+    // a model flat on y
+    vector<Vertex> flat;
+    for(int i = 0; i < 7; ++i)
+        flat.push_back(Vertex(Vec4((float)i, 1.5f, (float)-i, 0.0f), Vec3(0, 1, 0), Vec2(0.25f, 0.75f), Vec3((float)i, 1.5f, (float)-i)));
+
+    Errors flatErrors = RoundTrip(flat, Box(Vec3(0.0f, 1.5f, -6.0f), Vec3(6.0f, 1.5f, 0.0f)));
+
+    printf("max error: position %.3f steps, normal %.2e, uv %.3f half float steps, flat axis %.2e\n",
+           errors.position, errors.normal, errors.texcoord, flatErrors.flatAxis);
+
+    int failures = 0;
+
+    auto check = [&failures](bool passed, const char* what) {
+        if(!passed)
+        {
+            printf("FAILED: %s\n", what);
+            ++failures;
+        }
+    };
+
+    // a little over half a step for the rounding of the floats around it
+    check(errors.position <= 0.51f, "positions are within half a step of the box");
+    check(errors.normal <= 1e-4f, "normals keep 16 bit octahedral precision");
+    check(errors.texcoord <= 1.0f, "uvs are within half float rounding");
+    check(errors.worldPos == 0.0f, "worldPos is the unpacked position");
+    check(flatErrors.position <= 0.51f && flatErrors.flatAxis == 0.0f, "a flat axis unpacks exactly");
+
+    return failures == 0 ? 0 : 1;
+}
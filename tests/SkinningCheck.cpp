@@ -0,0 +1,206 @@
+/*---------------------------------------------------------------------------------------------
+*  Copyright (c) Nicolas Jinchereau. All rights reserved.
+*  Licensed under the MIT License. See License.txt in the project root for license information.
+*--------------------------------------------------------------------------------------------*/
+
+// Draws a skinned model headless while its clip bends it, and checks that what's on screen
+// follows the bones. The model is a strip two units tall, whose top half follows a second bone
+// that turns 90 degrees about Z over a second. Then plays the clip on a loop, and checks that once
+// every copy of the model has been skinned into, updating and drawing it doesn't allocate.
+
+#include "Camera.h"
+#include "CustomShaders.h"
+#include "JobSystem.h"
+#include "Mem.h"
+#include "Model.h"
+#include "RenderingContext.h"
+#include "Scene.h"
+#include "SceneObject.h"
+#include "SkinnedObject.h"
+#include "Texture.h"
+#include <cstdio>
+#include <vector>
+using namespace std;
+
+namespace
+{
+    const uint32_t Width = 160;
+    const uint32_t Height = 120;
+
+    BonePose MakePose(float x, float y, float z, const Quat& rotation)
+    {
+        BonePose pose = {
+            { x, y, z },
+            { rotation.v.x, rotation.v.y, rotation.v.z, rotation.w },
+            { 1.0f, 1.0f, 1.0f }
+        };
+        return pose;
+    }
+
+    shared_ptr<Model> MakeStrip()
+    {
+        auto model = AlignedMakeShared<Model, 16>();
+
+        // rows at y = 0, 1 and 2, following the root, both bones, and the second bone
+        const float rowWeights[3] = { 0.0f, 0.5f, 1.0f };
+
+        auto addVertex = [&](float x, int row) {
+            Vec3 position(x, (float)row, 0.0f);
+            Vec2 texcoord(x + 0.5f, row * 0.5f);
+            model->vertices.push_back(Vertex(position, Vec3(0, 0, -1), texcoord, texcoord, position));
+
+            SkinWeights skin = { { 1.0f - rowWeights[row], rowWeights[row], 0.0f, 0.0f }, { 0, 1, 0, 0 } };
+            model->skinWeights.push_back(skin);
+        };
+
+        for(int row = 0; row < 2; ++row)
+        {
+            const int quad[6][2] = { { 0, 0 }, { 0, 1 }, { 1, 1 }, { 0, 0 }, { 1, 1 }, { 1, 0 } };
+            for(auto& corner : quad)
+                addVertex(corner[0] ? 0.1f : -0.1f, row + corner[1]);
+        }
+
+        model->RecalcBounds();
+
+        Skeleton& skeleton = model->skeleton;
+        skeleton.bones.resize(2);
+        skeleton.bones[0].name = "root";
+        skeleton.bones[0].parent = -1;
+        skeleton.bones[0].bindPose = MakePose(0, 0, 0, Quat::identity);
+        skeleton.bones[0].offset = Mat4::identity;
+        skeleton.bones[1].name = "bend";
+        skeleton.bones[1].parent = 0;
+        skeleton.bones[1].bindPose = MakePose(0, 1, 0, Quat::identity);
+        skeleton.bones[1].offset = Mat4::Translation(0, -1, 0);
+
+        AnimationClip clip;
+        clip.name = "bend";
+        clip.frameRate = 30.0f;
+        clip.frameCount = 31;
+        clip.tracks.push_back({ 0, 1 });
+        clip.tracks.push_back({ 1, (uint32_t)clip.frameCount });
+        clip.keys.push_back(skeleton.bones[0].bindPose);
+
+        for(int frame = 0; frame < clip.frameCount; ++frame)
+            clip.keys.push_back(MakePose(0, 1, 0, Quat(0.0f, 0.0f, 90.0f * frame / (clip.frameCount - 1))));
+
+        model->animations.push_back(clip);
+        return model;
+    }
+
+    // the screen space bounds of the pixels that were drawn
+    struct Coverage
+    {
+        int minX = Width, minY = Height, maxX = -1, maxY = -1;
+
+        int width() const { return maxX - minX + 1; }
+        int height() const { return maxY - minY + 1; }
+    };
+
+    Coverage Draw(RenderingContext& context, const shared_ptr<Scene>& scene)
+    {
+        context.Clear(true, true);
+        context.Draw(scene);
+        context.Flush();
+
+        vector<uint32_t> pixels(Width * Height);
+        context.ReadPixels(pixels.data(), PixelFormat::BGRA8);
+
+        Coverage coverage;
+
+        for(int y = 0; y < (int)Height; ++y)
+        {
+            for(int x = 0; x < (int)Width; ++x)
+            {
+                if((pixels[y * Width + x] & 0xFFFFFF) == 0)
+                    continue;
+
+                coverage.minX = min(coverage.minX, x);
+                coverage.minY = min(coverage.minY, y);
+                coverage.maxX = max(coverage.maxX, x);
+                coverage.maxY = max(coverage.maxY, y);
+            }
+        }
+
+        return coverage;
+    }
+}
+
+int main()
+{
+    auto jobSystem = make_shared<JobSystem>(4);
+    auto context = AlignedMakeShared<RenderingContext, 16>(Width, Height, jobSystem);
+    context->clearColor(Color::clear);
+
+    auto scene = AlignedMakeShared<Scene, 16>();
+    scene->camera = AlignedMakeShared<Camera, 16>(60.0f, (float)Width / Height, 0.1f, 100.0f);
+    scene->camera->transform.SetPosition(0.0f, 1.0f, -4.0f);
+
+    Color32 white[16];
+    for(auto& pixel : white)
+        pixel = Color32(255, 255, 255, 255);
+
+    auto texture = AlignedMakeShared<Texture, 16>(white, 4, 4, FilterMode::Point);
+    auto shader = AlignedMakeShared<UnlitShader, 16>();
+    auto object = AlignedMakeShared<SceneObject, 16>("strip", MakeStrip(), texture, shader, CullMode::None);
+    scene->objects.push_back(object);
+
+    auto skinned = AlignedMakeShared<SkinnedObject, 16>(object);
+    skinned->loop = false;
+    vector<shared_ptr<SkinnedObject>> skinnedObjects{ skinned };
+
+    SkinnedObject::Update(skinnedObjects, 0.0f, *jobSystem);
+    Coverage straight = Draw(*context, scene);
+
+    // half way through the clip, then past its end, where it holds the last key
+    SkinnedObject::Update(skinnedObjects, 0.5f, *jobSystem);
+    Coverage halfway = Draw(*context, scene);
+
+    SkinnedObject::Update(skinnedObjects, 1.0f, *jobSystem);
+    Coverage bent = Draw(*context, scene);
+
+    printf("coverage (w x h): straight %d x %d, half way %d x %d, bent %d x %d\n",
+           straight.width(), straight.height(), halfway.width(), halfway.height(), bent.width(), bent.height());
+
+    int failures = 0;
+
+    auto check = [&failures](bool passed, const char* what) {
+        if(!passed)
+        {
+            printf("FAILED: %s\n", what);
+            ++failures;
+        }
+    };
+
+    check(object->model != skinned->bindModel(), "the object draws a skinned copy of its model");
+    check(straight.maxX >= 0, "the strip is drawn in its bind pose");
+    check(straight.height() > straight.width() * 4, "the strip starts out upright");
+    check(halfway.width() > straight.width() && halfway.height() < straight.height(), "the strip bends half way");
+    check(bent.width() > halfway.width() && bent.height() < halfway.height(), "the strip bends further by the end");
+    check(bent.width() > straight.width() * 4, "the top half ends up lying across");
+
+    auto play = [&](int frames)
+    {
+        for(int frame = 0; frame < frames; ++frame)
+        {
+            SkinnedObject::Update(skinnedObjects, 1.0f / 30.0f, *jobSystem);
+            context->Clear(true, true);
+            context->Draw(scene);
+            context->Present();
+        }
+
+        context->Flush();
+    };
+
+    skinned->loop = true;
+    play(60);
+
+    uint64_t allocations = AllocationCount();
+    play(60);
+    allocations = AllocationCount() - allocations;
+
+    printf("allocations over 60 frames of the clip: %llu\n", (unsigned long long)allocations);
+    check(allocations == 0, "playing the clip doesn't allocate");
+
+    return failures == 0 ? 0 : 1;
+}